@@ -26,30 +26,16 @@ DEFINES += QT_DEPRECATED_WARNINGS
 #MIKIPILOT = $$PWD/../../../mikipilot
 
 
-INCLUDEPATH += $$PWD/../../skyenet/algorithm/
-INCLUDEPATH += $$PWD/../../skyenet/cprs/headers/
-INCLUDEPATH += $$PWD/../../skyenet/csocp/
-INCLUDEPATH += $$PWD/../../mikipilot
-INCLUDEPATH += $$PWD/../../mikipilot/build/gcs/executable/release/
-
-# //SKYENET//
-LIBS += -L$$PWD/../../skyenet/algorithm -lalgorithm # looks for libalgorithm.a file
-LIBS += -L$$PWD/../../skyenet/cprs/build -lCPRS     # looks for libCPRS.a
-LIBS += -L$$PWD/../../skyenet/csocp -lCSOCP         # looks for libCSOCP.a
-
-# //MIKIPILOT//
-LIBS += -L$$PWD/../../mikipilot/build/gcs/executable/release/ -l_autogen_globals     # looks for lib_autogen_globals.a
-LIBS += -L$$PWD/../../mikipilot/build/gcs/executable/release/ -l_autogen_packet      # looks for lib_autogen_packet.a
-LIBS += -L$$PWD/../../mikipilot/build/gcs/executable/release/ -l_autogen_state       # looks for lib_autogen_state.a
-LIBS += -L$$PWD/../../mikipilot/build/gcs/executable/release/ -l_autogen_parameter   # looks for lib_autogen_parameter.a
-LIBS += -L$$PWD/../../mikipilot/build/gcs/executable/release/ -l_autogen_timestamped # looks for lib_autogen_timestamped.a
-LIBS += -L$$PWD/../../mikipilot/build/gcs/executable/release/ -l_autogen_bus         # looks for lib_autogen_bus.a
-LIBS += -L$$PWD/../../mikipilot/build/gcs/executable/release/ -l_network             # looks for lib_network.a
-LIBS += -L$$PWD/../../mikipilot/build/gcs/executable/release/ -l_utilities           # looks for lib_utilities.a
-LIBS += -L$$PWD/../../mikipilot/build/gcs/executable/release/ -l_gnc                 # looks for lib_gnc.a
+include(dependencies.pri)
 
 SOURCES += \
     src/controls/compute_thread.cpp \
+    src/controls/compute_scheduler.cpp \
+    src/controls/compute_worker.cpp \
+    src/controls/solve_timing.cpp \
+    src/controls/flight_recorder.cpp \
+    src/controls/flight_record_writer.cpp \
+    src/controls/reference_player.cpp \
     src/controls/controller.cpp \
     src/graphics/plane_resize_handle.cpp \
     src/graphics/waypoint_graphics_item.cpp \
@@ -61,6 +47,7 @@ SOURCES += \
     src/window/menu_panel.cpp \
     src/window/menu_button.cpp \
     src/models/constraint_model.cpp \
+    src/models/ellipse_index.cpp \
     src/globals.cpp \
     src/graphics/ellipse_graphics_item.cpp \
     src/graphics/ellipse_resize_handle.cpp \
@@ -69,16 +56,30 @@ SOURCES += \
     src/graphics/plane_graphics_item.cpp \
     src/graphics/drone_graphics_item.cpp \
     src/graphics/path_graphics_item.cpp \
+    src/graphics/background_tile_cache.cpp \
+    src/graphics/frame_timing.cpp \
+    src/graphics/level_of_detail.cpp \
     src/window/port_dialog.cpp \
     src/window/port_dialog/drone_id_selector.cpp \
     src/window/port_dialog/port_selector.cpp \
     src/network/drone_socket.cpp \
     src/network/ellipse_socket.cpp \
     src/graphics/point_graphics_item.cpp \
-    src/network/point_socket.cpp
+    src/network/point_socket.cpp \
+    src/network/network_thread.cpp \
+    src/network/mux_socket.cpp \
+    src/network/traj_uplink.cpp
 
 HEADERS += \
     include/controls/compute_thread.h \
+    include/controls/compute_scheduler.h \
+    include/controls/compute_worker.h \
+    include/controls/solve_timing.h \
+    include/controls/flight_record.h \
+    include/controls/flight_recorder.h \
+    include/controls/flight_record_queue.h \
+    include/controls/flight_record_writer.h \
+    include/controls/reference_player.h \
     include/graphics/plane_resize_handle.h \
     include/graphics/waypoint_graphics_item.h \
     include/network/waypoint_socket.h \
@@ -102,15 +103,29 @@ HEADERS += \
     include/models/path_model_item.h \
     include/models/drone_model_item.h \
     include/graphics/path_graphics_item.h \
+    include/graphics/background_tile_cache.h \
+    include/graphics/graphics_bounds.h \
+    include/graphics/frame_timing.h \
+    include/graphics/level_of_detail.h \
     include/window/port_dialog.h \
     include/window/port_dialog/drone_id_selector.h \
     include/window/port_dialog/port_selector.h \
     include/models/data_model.h \
+    include/models/model_generation.h \
+    include/models/seq_lock.h \
+    include/models/constraint_snapshot.h \
+    include/models/constraint_rows.h \
+    include/models/ellipse_geometry.h \
+    include/models/ellipse_index.h \
     include/network/ellipse_socket.h \
     include/models/point_model_item.h \
     include/graphics/point_graphics_item.h \
     include/network/drone_socket.h \
-    include/network/point_socket.h
+    include/network/point_socket.h \
+    include/network/network_thread.h \
+    include/network/mux_socket.h \
+    include/network/traj_chunk.h \
+    include/network/traj_uplink.h
 
 RESOURCES += \
     resources.qrc
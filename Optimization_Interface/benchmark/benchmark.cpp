@@ -0,0 +1,228 @@
+// TITLE:   Optimization_Interface/benchmark/benchmark.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Headless benchmark of the trajectory compute pipeline, runs the
+// compute thread solve on synthetic scenes and reports throughput
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QTextStream>
+#include <QVector>
+#include <QtMath>
+
+#include <algorithm>
+
+#include "include/controls/compute_thread.h"
+#include "include/models/constraint_model.h"
+#include "include/graphics/drone_graphics_item.h"
+#include "include/graphics/path_graphics_item.h"
+#include "include/globals.h"
+
+using optgui::ComputeThread;
+using optgui::ConstraintModel;
+using optgui::DroneGraphicsItem;
+using optgui::DroneModelItem;
+using optgui::EllipseModelItem;
+using optgui::PathGraphicsItem;
+using optgui::PathModelItem;
+using optgui::PointModelItem;
+using optgui::PolygonModelItem;
+using optgui::SolveTimingStats;
+
+// synthetic scene size
+struct BenchmarkScene {
+    quint32 num_ellipses;
+    // edges of one polygon constraint, 0 for no polygon
+    quint32 num_edges;
+    quint32 num_waypoints;
+    // skyenet P.K
+    quint32 horizon;
+};
+
+// summary of solves on one scene
+struct BenchmarkResult {
+    qreal solves_per_sec;
+    qreal p50;
+    qreal p99;
+    qreal maximum;
+    SolveTimingStats phases;
+};
+
+// scenes from empty to crowded at increasing horizons
+QVector<BenchmarkScene> const BENCHMARK_SCENES = {
+    {0, 0, 0, 10},
+    {4, 0, 0, 10},
+    {4, 6, 2, 20},
+    {8, 6, 2, 20},
+    {8, 12, 4, 30},
+    {16, 12, 4, 30}
+};
+
+// GUI coords of vehicle and target, obstacles are placed between them
+QPointF const BENCHMARK_START(-500, 0);
+QPointF const BENCHMARK_TARGET(500, 0);
+// GUI coords the vehicle is moved between warm solves, small enough
+// that it stays on the last traj like streamed telemetry
+qreal const BENCHMARK_WARM_NUDGE = 5;
+
+void loadScene(ConstraintModel *model, BenchmarkScene const &scene) {
+    model->setHorizon(qMin(scene.horizon,
+                           static_cast<quint32>(skyenet::MAX_HORIZON)));
+
+    // ellipses on a grid above and below the straight line path,
+    // spaced so obstacles with clearance do not overlap
+    for (quint32 i = 0; i < scene.num_ellipses; i++) {
+        quint32 col = i % 4;
+        quint32 row = i / 4;
+        qreal x = -300 + (col * 200);
+        qreal y = ((row % 2) ? 1 : -1) * (100 + ((row / 2) * 200));
+        model->addEllipse(new EllipseModelItem(QPointF(x, y),
+                                               model->getClearance(),
+                                               30, 30));
+    }
+
+    // regular polygon past the target
+    if (scene.num_edges >= 3) {
+        QVector<QPointF> points;
+        for (quint32 i = 0; i < scene.num_edges; i++) {
+            qreal theta = (2 * M_PI * i) / scene.num_edges;
+            points.append(QPointF(900 + (150 * qCos(theta)),
+                                  150 * qSin(theta)));
+        }
+        model->addPolygon(new PolygonModelItem(points));
+    }
+
+    // waypoints evenly along the straight line path
+    for (quint32 i = 0; i < scene.num_waypoints; i++) {
+        qreal x = -300 + ((600.0 * (i + 1)) / (scene.num_waypoints + 1));
+        model->addWaypoint(new PointModelItem(QPointF(x, 0)));
+    }
+}
+
+BenchmarkResult runScene(BenchmarkScene const &scene, quint32 num_solves,
+                         bool is_warm) {
+    // model owns and deletes all data models
+    ConstraintModel *model = new ConstraintModel();
+    loadScene(model, scene);
+
+    DroneModelItem *drone_model = new DroneModelItem(BENCHMARK_START);
+    PathModelItem *traj_model = new PathModelItem();
+    model->addDrone(drone_model, traj_model);
+    PointModelItem *target = new PointModelItem(BENCHMARK_TARGET);
+    model->addPoint(target);
+
+    // graphics are never added to a scene, only updated by the solve
+    DroneGraphicsItem *drone_graphic = new DroneGraphicsItem(drone_model);
+    PathGraphicsItem *traj_graphic = new PathGraphicsItem(traj_model);
+    ComputeThread *thread =
+            new ComputeThread(model, drone_graphic, traj_graphic);
+    thread->setTarget(target);
+
+    // warm up snapshot and solver allocations
+    thread->solve();
+
+    // time cold solves from reset inputs, or warm solves after
+    // new telemetry as the GUI runs in steady state
+    QVector<qint64> latencies;
+    latencies.reserve(num_solves);
+    QElapsedTimer total_timer;
+    total_timer.start();
+    for (quint32 i = 0; i < num_solves; i++) {
+        if (is_warm) {
+            qreal nudge = (i % 2) ? BENCHMARK_WARM_NUDGE : 0;
+            drone_model->setState(QVector3D(BENCHMARK_START.x() + nudge,
+                                            BENCHMARK_START.y(), 0),
+                                  QVector3D(), QVector3D(),
+                                  optgui::monotonicNsecs());
+        } else {
+            thread->reInit();
+        }
+        QElapsedTimer solve_timer;
+        solve_timer.start();
+        thread->solve();
+        latencies.append(solve_timer.nsecsElapsed());
+    }
+    qint64 total_nsecs = total_timer.nsecsElapsed();
+
+    BenchmarkResult result;
+    std::sort(latencies.begin(), latencies.end());
+    result.solves_per_sec = (num_solves * 1e9) / qMax(total_nsecs, 1LL);
+    result.p50 = optgui::percentileMsecs(latencies.constData(),
+                                         latencies.size(), 50);
+    result.p99 = optgui::percentileMsecs(latencies.constData(),
+                                         latencies.size(), 99);
+    result.maximum = optgui::percentileMsecs(latencies.constData(),
+                                             latencies.size(), 100);
+    result.phases = thread->getSolveTiming();
+
+    // clean up
+    delete thread;
+    delete traj_graphic;
+    delete drone_graphic;
+    delete model;
+
+    return result;
+}
+
+void printResult(QTextStream *out, char const *mode,
+                 BenchmarkScene const &scene, BenchmarkResult const &result) {
+    // one line per scene and mode, times in milliseconds
+    *out << mode
+         << " ellipses=" << scene.num_ellipses
+         << " edges=" << scene.num_edges
+         << " waypoints=" << scene.num_waypoints
+         << " K=" << scene.horizon
+         << " solves/s=" << QString::number(result.solves_per_sec, 'f', 1)
+         << " p50=" << QString::number(result.p50, 'f', 3)
+         << " p99=" << QString::number(result.p99, 'f', 3)
+         << " max=" << QString::number(result.maximum, 'f', 3)
+         << " snapshot_p50=" << QString::number(
+                result.phases.p50[optgui::SNAPSHOT_PHASE], 'f', 3)
+         << " params_p50=" << QString::number(
+                result.phases.p50[optgui::PARAM_LOAD_PHASE], 'f', 3)
+         << " solve_p50=" << QString::number(
+                result.phases.p50[optgui::UPDATE_PHASE], 'f', 3)
+         << " convert_p50=" << QString::number(
+                result.phases.p50[optgui::CONVERSION_PHASE], 'f', 3)
+         << "\n";
+    out->flush();
+}
+
+int main(int argc, char *argv[]) {
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("Optimization_Interface_Benchmark");
+
+    // parse options
+    QCommandLineParser parser;
+    parser.setApplicationDescription(
+            "Benchmark trajectory solves on synthetic scenes");
+    parser.addHelpOption();
+    QCommandLineOption solves_option(QStringList({"n", "solves"}),
+            "Timed solves per scene.", "solves", "100");
+    QCommandLineOption max_p99_option("max-p99",
+            "Fail if any scene p99 latency exceeds ms.", "ms");
+    parser.addOption(solves_option);
+    parser.addOption(max_p99_option);
+    parser.process(app);
+
+    quint32 num_solves = qMax(1u, parser.value(solves_option).toUInt());
+    bool has_max_p99 = parser.isSet(max_p99_option);
+    qreal max_p99 = parser.value(max_p99_option).toDouble();
+
+    // cold and warm solves of each scene
+    QTextStream out(stdout);
+    int exit_code = 0;
+    for (BenchmarkScene const &scene : BENCHMARK_SCENES) {
+        for (bool is_warm : {false, true}) {
+            BenchmarkResult result = runScene(scene, num_solves, is_warm);
+            printResult(&out, is_warm ? "warm" : "cold", scene, result);
+            if (has_max_p99 && result.p99 > max_p99) {
+                exit_code = 1;
+            }
+        }
+    }
+    return exit_code;
+}
@@ -0,0 +1,43 @@
+#-------------------------------------------------
+#
+# Headless benchmark of the trajectory compute pipeline
+#
+#-------------------------------------------------
+
+QT       += core gui
+
+greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
+
+TARGET = Optimization_Interface_Benchmark
+TEMPLATE = app
+CONFIG += console
+CONFIG -= app_bundle
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+# resolve include/... paths from the gui project
+INCLUDEPATH += $$PWD/..
+
+include(../dependencies.pri)
+
+SOURCES += \
+    benchmark.cpp \
+    ../src/controls/compute_thread.cpp \
+    ../src/controls/flight_recorder.cpp \
+    ../src/controls/flight_record_writer.cpp \
+    ../src/controls/solve_timing.cpp \
+    ../src/models/constraint_model.cpp \
+    ../src/models/ellipse_index.cpp \
+    ../src/globals.cpp \
+    ../src/graphics/drone_graphics_item.cpp \
+    ../src/graphics/path_graphics_item.cpp \
+    ../src/graphics/level_of_detail.cpp \
+    ../src/window/port_dialog/drone_id_selector.cpp \
+    ../src/window/port_dialog/port_selector.cpp
+
+HEADERS += \
+    ../include/controls/compute_thread.h \
+    ../include/controls/solve_timing.h \
+    ../include/controls/flight_record_writer.h \
+    ../include/window/port_dialog/drone_id_selector.h \
+    ../include/window/port_dialog/port_selector.h
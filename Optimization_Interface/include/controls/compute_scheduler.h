@@ -0,0 +1,76 @@
+// TITLE:   Optimization_Interface/include/controls/compute_scheduler.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Fixed pool of compute workers shared by all vehicles
+
+#ifndef COMPUTE_SCHEDULER_H_
+#define COMPUTE_SCHEDULER_H_
+
+#include <QMutex>
+#include <QWaitCondition>
+#include <QVector>
+#include <QMap>
+#include <QSet>
+
+#include "include/models/constraint_model.h"
+#include "include/controls/compute_thread.h"
+
+namespace optgui {
+
+class ComputeWorker;
+
+class ComputeScheduler {
+ public:
+    // start num_workers workers, 0 to size pool to cores
+    explicit ComputeScheduler(ConstraintModel *model,
+                              quint32 num_workers = 0);
+    ~ComputeScheduler();
+
+    // add vehicle to be solved by pool
+    void addJob(ComputeThread *job);
+    // stop solving vehicle, blocks until no worker is solving it
+    void removeJob(ComputeThread *job);
+
+    // functions for workers
+    bool isRunning();
+    // take highest priority vehicle that needs a solve,
+    // nullptr if none, vehicle inputs are checked without
+    // holding the jobs lock
+    ComputeThread *takeJob();
+    // hand vehicle back after solve
+    void finishJob(ComputeThread *job);
+
+ private:
+    ConstraintModel *model_;
+
+    // lock for jobs shared by workers and controller
+    QMutex mutex_;
+    // signaled when a worker finishes a solve
+    QWaitCondition job_finished_;
+
+    // vehicles in pool and vehicles being solved by a worker,
+    // a vehicle is solved by at most one worker at a time so
+    // changes while it is pending coalesce into one solve
+    QVector<ComputeThread *> jobs_;
+    QSet<ComputeThread *> busy_jobs_;
+    // solve count when vehicle was last taken, for fairness
+    QMap<ComputeThread *, quint64> last_taken_;
+    quint64 num_taken_;
+
+    bool is_running_;
+    QVector<ComputeWorker *> workers_;
+
+    // lower is solved first
+    quint32 getPriority(ComputeThread *job,
+                        DroneModelItem *curr_drone,
+                        DroneModelItem *staged_drone);
+    // flag idle vehicle as busy so it cannot be removed or taken
+    // by another worker, false if removed or already busy
+    bool claimJob(ComputeThread *job);
+};
+
+}  // namespace optgui
+
+#endif  // COMPUTE_SCHEDULER_H_
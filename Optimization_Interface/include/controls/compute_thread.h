@@ -3,12 +3,13 @@
 // LAB:     Autonomous Controls Lab (ACL)
 // LICENSE: Copyright 2020, All Rights Reserved
 
-// Thread for concurrently running Skyfly compute
+// Per vehicle Skyfly compute state, solved by compute scheduler workers
 
 #ifndef COMPUTE_THREAD_H_
 #define COMPUTE_THREAD_H_
 
-#include <QThread>
+#include <QObject>
+#include <QMutex>
 
 #include "cprs.h"
 #include "algorithm.h"
@@ -16,17 +17,33 @@
 #include "include/models/constraint_model.h"
 #include "include/graphics/path_graphics_item.h"
 #include "include/graphics/drone_graphics_item.h"
+#include "include/controls/solve_timing.h"
+#include "include/controls/flight_record_writer.h"
 #include "include/globals.h"
 
 namespace optgui {
 
-class ComputeThread : public QThread {
+// max time to sleep between checks for changed inputs
+unsigned long const COMPUTE_IDLE_TIMEOUT_MS = 250;
+// max change in traj (meters) for successive solves to be converged
+qreal const COMPUTE_CONVERGED_TOL = 1e-3;
+// max solves with unchanged inputs before sleeping
+quint32 const COMPUTE_MAX_REFINE_SOLVES = 20;
+// max time (seconds) telemetry is propagated forward, bounds
+// extrapolation of stale samples
+qreal const COMPUTE_MAX_PROPAGATION_SEC = 0.25;
+// weight of latest solve in expected solve duration average
+qreal const COMPUTE_SOLVE_TIME_WEIGHT = 0.2;
+
+class ComputeThread : public QObject {
     Q_OBJECT
 
  public:
+    // published solves are recorded if writer is not null
     explicit ComputeThread(ConstraintModel *model,
                            DroneGraphicsItem *drone,
-                           PathGraphicsItem *traj_graphic);
+                           PathGraphicsItem *traj_graphic,
+                           FlightRecordWriter *record_writer = nullptr);
     ~ComputeThread();
 
     PathGraphicsItem *getTrajGraphic();
@@ -36,15 +53,23 @@ class ComputeThread : public QThread {
     void stopCompute();
     DroneGraphicsItem *getDroneGraphic();
 
- protected:
-    void run() override;
+    // check whether inputs changed or traj not yet converged,
+    // called by scheduler before handing vehicle to a worker
+    bool needsSolve();
+    // run one solve with latest inputs on calling worker thread
+    void solve();
 
- // slots for signals from thread are run in parent thread
+    // per phase timing of recent solves
+    SolveTimingStats getSolveTiming();
+
+ // slots for signals from workers are run in parent thread
  signals:
     void updateGraphics(PathGraphicsItem *traj_graphic,
                         DroneGraphicsItem *drone_graphic);
     void updateMessage(DroneModelItem *drone);
     void finalTime(DroneModelItem *drone, double final_time);
+    void solveTiming(DroneModelItem *drone);
+    void updateEllipseGraphics();
 
  private:
     // GUI data
@@ -57,22 +82,53 @@ class ComputeThread : public QThread {
     PointModelItem *target_;
     PathGraphicsItem *traj_graphic_;
 
-    // compute traj flag
+    // compute traj flag, cleared when vehicle is removed
     bool run_loop_;
 
-    // lock for accessing resources shared by compute_thread and controller
+    // lock for accessing resources shared by workers and controller
     // (target and run flag)
     QMutex mutex_;
 
     // flag to reset inputs
     bool target_changed_;
 
-    INPUT_CODE validateInputs(QVector<QRegion> const &ellipse_regions,
+    // inputs of last solve, used to sleep until inputs change
+    quint64 solved_generation_;
+    quint64 solved_drone_generation_;
+    // number of solves with unchanged inputs
+    quint32 refine_solves_;
+    // flag for successive solves with unchanged inputs converging
+    bool is_converged_;
+    // last solved traj in meters, used to detect convergence
+    QVector<QVector3D> solved_traj_;
+
+    // preallocated conversion outputs, points are double
+    // buffered with the traj model
+    QVector<QPointF> traj_points_;
+    autogen::packet::traj3dof traj3dof_data_;
+
+    // timing of recent solves, written by solving worker
+    // and read by GUI thread
+    SolveTiming timing_;
+    // moving average of time from reading telemetry to
+    // publishing traj, in nanoseconds
+    qreal expected_solve_nsecs_;
+    // flight record writer owned by controller and queue
+    // of this vehicle's solves, pushed by solving worker
+    FlightRecordWriter *record_writer_;
+    FlightRecordQueue *records_;
+
+    // predict vehicle state at expected solve completion
+    DroneState propagateState(DroneState const &state);
+
+    INPUT_CODE validateInputs(EllipseIndex const &ellipse_index,
                               QVector3D const &initial_pos,
                               QVector3D const &final_pos);
     void setFeasibilityColor(bool is_feasible);
 
     bool getRunFlag();
+    // check whether traj moved since last solve with same inputs
+    bool isConverged(skyenet::outputs const &O, quint32 size);
 };
 
 }  // namespace optgui
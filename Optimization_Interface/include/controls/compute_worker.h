@@ -0,0 +1,36 @@
+// TITLE:   Optimization_Interface/include/controls/compute_worker.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Worker thread taking vehicle solves from compute scheduler
+
+#ifndef COMPUTE_WORKER_H_
+#define COMPUTE_WORKER_H_
+
+#include <QThread>
+
+#include "include/models/constraint_model.h"
+
+namespace optgui {
+
+class ComputeScheduler;
+
+class ComputeWorker : public QThread {
+    Q_OBJECT
+
+ public:
+    explicit ComputeWorker(ConstraintModel *model,
+                           ComputeScheduler *scheduler);
+
+ protected:
+    void run() override;
+
+ private:
+    ConstraintModel *model_;
+    ComputeScheduler *scheduler_;
+};
+
+}  // namespace optgui
+
+#endif  // COMPUTE_WORKER_H_
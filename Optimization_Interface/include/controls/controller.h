@@ -21,7 +21,12 @@
 #include "include/network/ellipse_socket.h"
 #include "include/network/waypoint_socket.h"
 #include "include/network/point_socket.h"
+#include "include/network/mux_socket.h"
+#include "include/network/network_thread.h"
 #include "include/controls/compute_thread.h"
+#include "include/controls/compute_scheduler.h"
+#include "include/controls/flight_record_writer.h"
+#include "include/controls/reference_player.h"
 
 namespace optgui {
 
@@ -32,7 +37,7 @@ class Controller : public QObject {
     explicit Controller(Canvas *canvas);
     ~Controller();
 
-    // SkyFly compute thread
+    // SkyFly compute state per vehicle
     QMap<DroneModelItem *, ComputeThread *> compute_threads_;
 
     // add constraints
@@ -81,23 +86,30 @@ class Controller : public QObject {
     void setCurrDrone(DroneModelItem *drone);
     FEASIBILITY_CODE getIsValidTraj();
     INPUT_CODE getIsValidInput();
+    SolveTimingStats getSolveTiming();
 
  signals:
-    void trajectoryExecuted(DroneModelItem *, autogen::packet::traj3dof data);
+    void trajectoryExecuted(DroneModelItem *, QByteArray datagram);
     // signal view to update
     void finalTime(qreal time);
     void updateMessage();
+    void solveTiming();
 
  private slots:
     // receive update from compute thread, check if
     // drone is current drone
     void updateMessage(DroneModelItem *drone);
     void finalTime(DroneModelItem *drone, qreal time);
+    void solveTiming(DroneModelItem *drone);
     void startSockets();
+    // sync graphics with models updated by sockets
+    void refreshNetworkGraphics();
     void tickLiveReference();
 
  private:
     ConstraintModel *model_;
+    // worker pool solving all vehicles
+    ComputeScheduler *compute_scheduler_;
 
     // QGraphicsScene
     Canvas *canvas_;
@@ -110,23 +122,32 @@ class Controller : public QObject {
     bool is_simulated_;
     bool traj_lock_;
 
-    // Data capture
+    // Data capture, records while a traj is executed.
+    // Writer thread drains one queue per producer: network
+    // thread sockets, each compute thread, and reference ticks
     bool capture_data_;
-    QFile *output_file_;
-    void createOutputFile();
-    void updateOutputFile(const autogen::packet::traj3dof &traj,
-                          DroneModelItem *staged_drone, int index);
-
-    // freeze traj timer
+    FlightRecordWriter *record_writer_;
+    FlightRecordQueue *network_records_;
+    FlightRecordQueue *reference_records_;
+    void startRecording();
+    void recordReference(DroneModelItem *staged_drone,
+                         ReferenceSample const &sample);
+
+    // freeze traj timer, samples executed traj on
+    // monotonic clock while active
     QTimer *freeze_traj_timer_;
-    quint32 traj_index_;
+    ReferencePlayer reference_player_;
 
     // network configuration dialog box
     PortDialog *port_dialog_;
+    // event loop reading all sockets
+    NetworkThread *network_thread_;
     QVector<DroneSocket *> drone_sockets_;
     QVector<PointSocket *> final_point_sockets_;
     QVector<WaypointSocket *> waypoint_sockets_;
     QVector<EllipseSocket *> ellipse_sockets_;
+    // single socket for all objects when multiplexed
+    MuxSocket *mux_socket_;
 
     // remove items
     void removeDroneSocket(DroneModelItem *model);
@@ -0,0 +1,60 @@
+// TITLE:   Optimization_Interface/include/controls/flight_record.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Fixed size binary record of flight data recorder files,
+// shared by the recorder and the offline converter
+
+#ifndef FLIGHT_RECORD_H_
+#define FLIGHT_RECORD_H_
+
+#include <QtGlobal>
+
+namespace optgui {
+
+// kinds of recorded events
+enum FLIGHT_RECORD_TYPE {
+    HEADER_RECORD,
+    // values: pos, vel, accel ned as received
+    TELEMETRY_RECORD,
+    // values: propagated initial pos, vel ned, final time, feasible,
+    // latency nsecs, horizon
+    SOLVE_RECORD,
+    // values: ref pos, vel, accel ned, traj time, knot index
+    REFERENCE_RECORD,
+    // values: records dropped by a full queue since last drop,
+    // producer of the queue, vehicle is of the last dropped record
+    DROP_RECORD
+};
+
+// threads pushing records, each into its own queue
+enum FLIGHT_RECORD_PRODUCER {
+    NETWORK_PRODUCER,
+    REFERENCE_PRODUCER,
+    SOLVER_PRODUCER
+};
+
+quint32 const FLIGHT_RECORD_VALUES = 14;
+
+// record is 128 bytes, the first record of a file is a header
+struct FlightRecord {
+    quint32 type;
+    // vehicle id, the port configured for the vehicle
+    quint32 vehicle;
+    // monotonic time in nanoseconds
+    qint64 stamp_nsecs;
+    double values[FLIGHT_RECORD_VALUES];
+};
+
+static_assert(sizeof(FlightRecord) == 128,
+              "FlightRecord must stay 128 bytes on disk");
+
+// header record stores magic in vehicle field, version in
+// first value
+quint32 const FLIGHT_RECORD_MAGIC = 0x4F494652;  // "OIFR"
+quint32 const FLIGHT_RECORD_VERSION = 1;
+
+}  // namespace optgui
+
+#endif  // FLIGHT_RECORD_H_
@@ -0,0 +1,85 @@
+// TITLE:   Optimization_Interface/include/controls/flight_record_queue.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Bounded lock free single producer single consumer queue of
+// flight records, one per recording thread
+
+#ifndef FLIGHT_RECORD_QUEUE_H_
+#define FLIGHT_RECORD_QUEUE_H_
+
+#include <QVector>
+
+#include <atomic>
+
+#include "include/controls/flight_record.h"
+
+namespace optgui {
+
+// records buffered per producer, power of two, 512 KiB
+quint64 const FLIGHT_RECORD_QUEUE_SIZE = 4096;
+
+class FlightRecordQueue {
+ public:
+    explicit FlightRecordQueue(FLIGHT_RECORD_PRODUCER producer)
+        : records_(FLIGHT_RECORD_QUEUE_SIZE), producer_(producer),
+          head_(0), tail_(0), dropped_(0), dropped_vehicle_(0) {}
+
+    // copy record into queue without blocking, producer only,
+    // record is dropped and counted if the queue is full
+    bool push(FlightRecord const &record) {
+        quint64 tail = this->tail_.load(std::memory_order_relaxed);
+        if (tail - this->head_.load(std::memory_order_acquire) >=
+                FLIGHT_RECORD_QUEUE_SIZE) {
+            this->dropped_vehicle_.store(record.vehicle,
+                                         std::memory_order_relaxed);
+            this->dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        this->records_[tail & (FLIGHT_RECORD_QUEUE_SIZE - 1)] = record;
+        this->tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // take oldest record, consumer only
+    bool pop(FlightRecord *record) {
+        quint64 head = this->head_.load(std::memory_order_relaxed);
+        if (head == this->tail_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        *record = this->records_[head & (FLIGHT_RECORD_QUEUE_SIZE - 1)];
+        this->head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // records dropped since queue was created
+    quint64 getDropped() const {
+        return this->dropped_.load(std::memory_order_relaxed);
+    }
+
+    // vehicle of the most recently dropped record
+    quint32 getDroppedVehicle() const {
+        return this->dropped_vehicle_.load(std::memory_order_relaxed);
+    }
+
+    FLIGHT_RECORD_PRODUCER getProducer() const {
+        return this->producer_;
+    }
+
+ private:
+    QVector<FlightRecord> records_;
+    FLIGHT_RECORD_PRODUCER const producer_;
+    // next record to pop, written by consumer
+    std::atomic<quint64> head_;
+    // keep producer and consumer counters on separate cache lines
+    char padding_[64];
+    // next record to push, written by producer
+    std::atomic<quint64> tail_;
+    std::atomic<quint64> dropped_;
+    std::atomic<quint32> dropped_vehicle_;
+};
+
+}  // namespace optgui
+
+#endif  // FLIGHT_RECORD_QUEUE_H_
@@ -0,0 +1,72 @@
+// TITLE:   Optimization_Interface/include/controls/flight_record_writer.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Background thread draining per producer record queues into the
+// flight recorder, keeps file I/O off GUI, network, and solver threads
+
+#ifndef FLIGHT_RECORD_WRITER_H_
+#define FLIGHT_RECORD_WRITER_H_
+
+#include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QVector>
+#include <QString>
+
+#include "include/controls/flight_recorder.h"
+#include "include/controls/flight_record_queue.h"
+
+namespace optgui {
+
+// max time records wait in a queue before being written
+unsigned long const FLIGHT_RECORD_WRITER_PERIOD_MS = 10;
+
+class FlightRecordWriter : public QThread {
+    Q_OBJECT
+
+ public:
+    explicit FlightRecordWriter(QObject *parent = nullptr);
+    ~FlightRecordWriter();
+
+    // open and close run on the writer thread after its next
+    // drain, callers never wait on disk or a drain
+    // start new recording, closing the previous one
+    void open(QString const &filename);
+    void close();
+
+    // queue for one producer thread, owned by writer
+    FlightRecordQueue *createQueue(FLIGHT_RECORD_PRODUCER producer);
+    // write remaining records and delete queue
+    void destroyQueue(FlightRecordQueue *queue);
+
+ protected:
+    void run() override;
+
+ private:
+    // mutex lock for queues and recorder, held while draining
+    QMutex mutex_;
+    QWaitCondition stop_;
+    bool is_stopped_;
+    // mutex lock for requested open and close, never held
+    // during a drain or file I/O
+    QMutex request_mutex_;
+    bool is_close_requested_;
+    bool is_open_requested_;
+    QString requested_filename_;
+    QVector<FlightRecordQueue *> queues_;
+    // drops already recorded per queue
+    QVector<quint64> recorded_drops_;
+    FlightRecorder recorder_;
+
+    // move queued records into recorder, caller holds lock
+    void drain();
+    // close and open recording if requested, caller holds lock
+    void applyRequests();
+    void drainQueue(qint32 index);
+};
+
+}  // namespace optgui
+
+#endif  // FLIGHT_RECORD_WRITER_H_
@@ -0,0 +1,69 @@
+// TITLE:   Optimization_Interface/include/controls/flight_recorder.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Append only flight data recorder writing fixed size records
+// into a memory mapped file
+
+#ifndef FLIGHT_RECORDER_H_
+#define FLIGHT_RECORDER_H_
+
+#include <QFile>
+#include <QMutex>
+#include <QString>
+#include <QVector3D>
+
+#include "include/controls/flight_record.h"
+
+namespace optgui {
+
+// records mapped at a time, file grows by one segment when full
+qint64 const FLIGHT_RECORDER_SEGMENT_RECORDS = 32768;
+
+class FlightRecorder {
+ public:
+    FlightRecorder();
+    ~FlightRecorder();
+
+    // start new recording, closes any open recording
+    bool open(QString const &filename);
+    // truncate file to recorded records and close it
+    void close();
+    bool isOpen();
+
+    // copy record into file, dropped if not open,
+    // safe to call from any thread
+    void append(FlightRecord const &record);
+
+    // record with type, vehicle, and stamp set and values zeroed
+    static FlightRecord makeRecord(FLIGHT_RECORD_TYPE type,
+                                   quint32 vehicle, qint64 stamp_nsecs);
+    // telemetry record from state in gui coords, stored in ned
+    static FlightRecord telemetryRecord(quint32 vehicle, qint64 stamp_nsecs,
+                                        QVector3D const &pos,
+                                        QVector3D const &vel,
+                                        QVector3D const &accel);
+    // store vector in three values starting at index
+    static void setValues(FlightRecord *record, quint32 index,
+                          QVector3D const &vector);
+
+ private:
+    // mutex lock for file and mapping
+    QMutex mutex_;
+    QFile *file_;
+    // mapped segment of records
+    FlightRecord *segment_;
+    // index of mapped segment
+    qint64 segment_index_;
+    // records written including header
+    qint64 num_records_;
+
+    // grow file and map segment, caller holds lock
+    bool mapSegment(qint64 segment_index);
+    void closeFile();
+};
+
+}  // namespace optgui
+
+#endif  // FLIGHT_RECORDER_H_
@@ -0,0 +1,59 @@
+// TITLE:   Optimization_Interface/include/controls/reference_player.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Plays back an executed trajectory against the monotonic clock,
+// interpolating between knots at the true elapsed time
+
+#ifndef REFERENCE_PLAYER_H_
+#define REFERENCE_PLAYER_H_
+
+#include <QVector3D>
+
+#include "autogen/lib.h"
+
+namespace optgui {
+
+// time between reference updates, independent of knot spacing
+int const REFERENCE_PLAYER_PERIOD_MS = 20;
+
+// reference state at one instant, ned
+struct ReferenceSample {
+    QVector3D pos;
+    QVector3D vel;
+    QVector3D accel;
+    // traj time in seconds
+    qreal time;
+    // knot at start of current segment
+    quint32 index;
+    // monotonic time sampled in nanoseconds
+    qint64 stamp_nsecs;
+};
+
+class ReferencePlayer {
+ public:
+    ReferencePlayer();
+
+    // start playing traj from its first knot at start time
+    void start(autogen::packet::traj3dof const &traj, qint64 start_nsecs);
+    // sample traj at monotonic time, the final knot is
+    // returned once when time runs past it, then false
+    bool sample(qint64 now_nsecs, ReferenceSample *sample);
+    quint32 getNumKnots();
+
+ private:
+    autogen::packet::traj3dof traj_;
+    qint64 start_nsecs_;
+    // segment of last sample, time only moves forward
+    quint32 index_;
+    bool is_finished_;
+
+    QVector3D knotPos(quint32 index);
+    QVector3D knotVel(quint32 index);
+    QVector3D knotAccel(quint32 index);
+};
+
+}  // namespace optgui
+
+#endif  // REFERENCE_PLAYER_H_
@@ -0,0 +1,62 @@
+// TITLE:   Optimization_Interface/include/controls/solve_timing.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Per phase timing of recent vehicle solves
+
+#ifndef SOLVE_TIMING_H_
+#define SOLVE_TIMING_H_
+
+#include <QAtomicInteger>
+
+namespace optgui {
+
+// phases of one vehicle solve
+enum SOLVE_PHASE {
+    SNAPSHOT_PHASE,
+    PARAM_LOAD_PHASE,
+    UPDATE_PHASE,
+    CONVERSION_PHASE,
+    EMIT_PHASE,
+    NUM_SOLVE_PHASES
+};
+
+// number of recent solves kept per phase
+quint32 const SOLVE_TIMING_SAMPLES = 128;
+
+// summary of recent solves in milliseconds
+struct SolveTimingStats {
+    qreal p50[NUM_SOLVE_PHASES];
+    qreal p99[NUM_SOLVE_PHASES];
+    qreal maximum[NUM_SOLVE_PHASES];
+    // total solves recorded
+    quint64 num_solves;
+};
+
+class SolveTiming {
+ public:
+    SolveTiming();
+
+    // record phase of current solve, only called by
+    // the worker solving the vehicle
+    void record(SOLVE_PHASE phase, qint64 nsecs);
+    // publish phases of current solve
+    void finishSolve();
+
+    // summarize recent solves without locking,
+    // can be called from any thread
+    SolveTimingStats getStats();
+
+ private:
+    // ring buffers of phase durations in nanoseconds,
+    // atomic so reads never see a torn sample
+    QAtomicInteger<qint64> samples_[NUM_SOLVE_PHASES][SOLVE_TIMING_SAMPLES];
+    // number of published solves, current solve writes to
+    // the slot after the last published one
+    QAtomicInteger<quint64> num_solves_;
+};
+
+}  // namespace optgui
+
+#endif  // SOLVE_TIMING_H_
@@ -70,6 +70,13 @@ namespace optgui {
     QVector3D guiXyzToXyz(qreal x, qreal y, qreal z);
     QVector3D xyzToGuiXyz(QVector3D const &xyz_coords);
     QVector3D xyzToGuiXyz(qreal x, qreal y, qreal z);
+    QPointF xyzToGuiXy(qreal x, qreal y);
+
+    // monotonic clock for telemetry timestamps
+    qint64 monotonicNsecs();
+    // nearest rank percentile of sorted nanoseconds in milliseconds
+    qreal percentileMsecs(qint64 const *sorted, quint32 size,
+                          quint32 percent);
 }  // namespace optgui
 
 #endif  // GLOBALS_H_
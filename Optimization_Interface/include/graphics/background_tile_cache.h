@@ -0,0 +1,79 @@
+// TITLE:   Optimization_Interface/include/graphics/background_tile_cache.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Cached tiles of the canvas background with site image and grid
+// rendered once per zoom level, so repaints only blit visible tiles
+
+#ifndef BACKGROUND_TILE_CACHE_H_
+#define BACKGROUND_TILE_CACHE_H_
+
+#include <QCache>
+#include <QColor>
+#include <QHash>
+#include <QImage>
+#include <QPainter>
+#include <QPixmap>
+#include <QRectF>
+#include <QVector>
+
+namespace optgui {
+
+// side of one tile in pixels
+qint32 const BACKGROUND_TILE_SIZE = 256;
+// max memory of cached tiles in KiB
+qint32 const BACKGROUND_TILE_CACHE_KB = 64 * 1024;
+// zoom levels, each halves the tile resolution
+qint32 const BACKGROUND_MIN_LEVEL = -2;
+qint32 const BACKGROUND_MAX_LEVEL = 12;
+
+// tile at a zoom level and grid spacing
+struct BackgroundTileKey {
+    qint32 level;
+    qint64 segment_size;
+    qint64 x;
+    qint64 y;
+
+    bool operator==(BackgroundTileKey const &other) const {
+        return this->level == other.level &&
+                this->segment_size == other.segment_size &&
+                this->x == other.x && this->y == other.y;
+    }
+};
+
+inline uint qHash(BackgroundTileKey const &key, uint seed = 0) {
+    return ::qHash(key.x, seed) ^ ::qHash(key.y, seed + 1) ^
+            ::qHash(key.segment_size, seed + 2) ^
+            (static_cast<uint>(key.level) << 24);
+}
+
+class BackgroundTileCache {
+ public:
+    BackgroundTileCache();
+
+    // site image covering scene rect, null image for grid only
+    void setImage(QImage const &image, QRectF const &bbox);
+    void setStyle(QColor const &background_color, QColor const &grid_color);
+
+    // blit tiles covering exposed scene rect at view scale,
+    // rendering missing tiles
+    void draw(QPainter *painter, QRectF const &rect, qreal scale,
+              qint64 segment_size);
+
+ private:
+    // full resolution image is level 0 of image pyramid
+    QVector<QImage> image_levels_;
+    QRectF bbox_;
+    QCache<BackgroundTileKey, QPixmap> tiles_;
+    QColor background_color_;
+    QColor grid_color_;
+
+    QPixmap *renderTile(BackgroundTileKey const &key);
+    // image downsampled 2^level times, built on first use
+    QImage const &imageLevel(qint32 level);
+};
+
+}  // namespace optgui
+
+#endif  // BACKGROUND_TILE_CACHE_H_
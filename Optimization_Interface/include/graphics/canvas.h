@@ -10,6 +10,9 @@
 
 #include <QGraphicsScene>
 #include <QFont>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QSet>
 
 #include "include/graphics/path_graphics_item.h"
 #include "include/graphics/drone_graphics_item.h"
@@ -18,9 +21,13 @@
 #include "include/graphics/ellipse_graphics_item.h"
 #include "include/graphics/polygon_graphics_item.h"
 #include "include/graphics/plane_graphics_item.h"
+#include "include/graphics/background_tile_cache.h"
 
 namespace optgui {
 
+// frame rate used when display refresh rate is unknown
+qreal const CANVAS_DEFAULT_REFRESH_RATE = 60;
+
 class Canvas : public QGraphicsScene {
     Q_OBJECT
 
@@ -50,12 +57,27 @@ class Canvas : public QGraphicsScene {
     // move selected item to top render level
     void bringSelectedToFront();
 
-    // manually force a re-render of item
+    // mark items to re-render on next frame
     void updateGraphicsItems(PathGraphicsItem *, DroneGraphicsItem *);
+    // mark ellipses to re-render on next frame after color change
+    void updateEllipseGraphics();
+    // schedule next frame, requests are coalesced to at most
+    // one repaint per display refresh
+    void requestFrame();
+
+ signals:
+    // emitted at start of frame to sync graphics with models
+    // written by other threads
+    void syncGraphics();
+
+ private slots:
+    // repaint areas of items changed since last frame
+    void renderFrame();
 
  private:
     void setBackgroundImage(QString filename);
-    QImage background_image_;
+    // site image and grid tiles per zoom level
+    BackgroundTileCache background_tiles_;
 
     // member variables for graphical style
     QPen background_pen_;
@@ -65,9 +87,17 @@ class Canvas : public QGraphicsScene {
     // max render level, used for move selected to front
     qreal front_depth_;
 
-    // helper functions for drawing grid lines
-    qint64 roundUpPast(qint64 n, qint64 m);
-    qint64 roundDownPast(qint64 n, qint64 m);
+    // grid spacing in pixels for zoom scale
+    qint64 gridSegmentSize(qreal scale);
+
+    // frame pacing
+    QTimer *frame_timer_;
+    QElapsedTimer last_frame_;
+    qint64 frame_period_msecs_;
+    // items changed since last frame
+    QSet<PathGraphicsItem *> dirty_paths_;
+    QSet<DroneGraphicsItem *> dirty_drones_;
+    bool ellipses_dirty_;
 
     // size of backgorund image
     qreal background_bottomleft_x_ = 0;
@@ -52,6 +52,10 @@ class DroneGraphicsItem : public QGraphicsItem {
 
     // size of drone
     qreal size_;
+    // diamond shape cached for zoom it was built at
+    QPolygonF diamond_;
+    qreal diamond_scale_;
+    QPolygonF diamond(qreal scaling_factor) const;
 
     // for compute thread setting infeasible
     QMutex mutex_;
@@ -0,0 +1,46 @@
+// TITLE:   Optimization_Interface/include/graphics/frame_timing.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Render timing of recent view frames
+
+#ifndef FRAME_TIMING_H_
+#define FRAME_TIMING_H_
+
+#include <QtGlobal>
+
+namespace optgui {
+
+// number of recent frames kept
+quint32 const FRAME_TIMING_SAMPLES = 128;
+
+// summary of recent frames in milliseconds
+struct FrameTimingStats {
+    qreal p50;
+    qreal p99;
+    qreal maximum;
+    // total frames recorded
+    quint64 num_frames;
+};
+
+class FrameTiming {
+ public:
+    FrameTiming();
+
+    // record render time of one frame, only called
+    // from GUI thread
+    void record(qint64 nsecs);
+
+    // summarize recent frames
+    FrameTimingStats getStats() const;
+
+ private:
+    // ring buffer of frame durations in nanoseconds
+    qint64 samples_[FRAME_TIMING_SAMPLES];
+    quint64 num_frames_;
+};
+
+}  // namespace optgui
+
+#endif  // FRAME_TIMING_H_
@@ -0,0 +1,43 @@
+// TITLE:   Optimization_Interface/include/graphics/graphics_bounds.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Painted area of graphics items, the view only repaints dirty
+// bounding rects so they must cover outlines and port labels
+
+#ifndef GRAPHICS_BOUNDS_H_
+#define GRAPHICS_BOUNDS_H_
+
+#include <QRectF>
+
+#include "include/graphics/level_of_detail.h"
+
+namespace optgui {
+
+// half size of port label box drawn by items, in screen pixels
+qreal const LABEL_BOX_SIZE = 50;
+// widest outline pen drawn by items, in screen pixels
+qreal const OUTLINE_PEN_WIDTH = 3;
+
+// grow shape bounds by the widest outline pen and, if labeled
+// at this zoom, by the label box centered at label_pos, label_scale covers
+// label boxes drawn rotated relative to the item
+inline QRectF paintedBounds(QRectF const &shape_bounds,
+                            qreal scaling_factor, bool is_labeled,
+                            QPointF const &label_pos = QPointF(),
+                            qreal label_scale = 1) {
+    qreal pad = OUTLINE_PEN_WIDTH / scaling_factor;
+    QRectF bounds = shape_bounds.adjusted(-pad, -pad, pad, pad);
+    if (is_labeled && isLabelVisible(scaling_factor)) {
+        qreal half = (LABEL_BOX_SIZE * label_scale) / scaling_factor;
+        bounds = bounds.united(QRectF(label_pos.x() - half,
+                                      label_pos.y() - half,
+                                      half * 2, half * 2));
+    }
+    return bounds;
+}
+
+}  // namespace optgui
+
+#endif  // GRAPHICS_BOUNDS_H_
@@ -0,0 +1,52 @@
+// TITLE:   Optimization_Interface/include/graphics/level_of_detail.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Level of detail of graphics items keyed on view zoom, keeps
+// dense scenes fluid when zoomed out
+
+#ifndef LEVEL_OF_DETAIL_H_
+#define LEVEL_OF_DETAIL_H_
+
+#include <QPainter>
+#include <QPolygonF>
+#include <QRectF>
+#include <QtMath>
+
+namespace optgui {
+
+// zoom below which port labels are not drawn
+qreal const LOD_LABEL_MIN_SCALE = 0.2;
+// on screen size in pixels below which resize handles are
+// hidden, handles would cover the item
+qreal const LOD_HANDLE_MIN_PIXELS = 40;
+// on screen size in pixels below which items are drawn as glyph
+qreal const LOD_GLYPH_PIXELS = 2;
+// max on screen deviation in pixels of decimated trajectories
+qreal const LOD_PATH_TOLERANCE_PIXELS = 0.5;
+
+inline bool isLabelVisible(qreal scaling_factor) {
+    return scaling_factor >= LOD_LABEL_MIN_SCALE;
+}
+
+inline qreal screenSize(QRectF const &bounds, qreal scaling_factor) {
+    // larger side of item bounds in screen pixels
+    return qMax(bounds.width(), bounds.height()) * scaling_factor;
+}
+
+inline void drawGlyph(QPainter *painter, QPointF const &center,
+                      QColor const &color, qreal scaling_factor) {
+    // fill square of glyph size in screen pixels
+    qreal half = (LOD_GLYPH_PIXELS / 2) / scaling_factor;
+    painter->fillRect(QRectF(center.x() - half, center.y() - half,
+                             half * 2, half * 2), color);
+}
+
+// Douglas-Peucker decimation of polyline, kept points are within
+// tolerance of the original, end points are always kept
+QPolygonF decimatePolyline(QPolygonF const &points, qreal tolerance);
+
+}  // namespace optgui
+
+#endif  // LEVEL_OF_DETAIL_H_
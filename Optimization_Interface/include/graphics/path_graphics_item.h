@@ -28,6 +28,9 @@ class PathGraphicsItem : public QGraphicsItem {
                QWidget *widget = nullptr) override;
     // set color of traj
     void setColor(QColor);
+    // snapshot model points and schedule repaint of old and
+    // new area, called on GUI thread after model changed
+    void syncGeometry();
 
     PathModelItem *model_;
 
@@ -41,6 +44,14 @@ class PathGraphicsItem : public QGraphicsItem {
  private:
     QPen pen_;
     quint32 width_;
+    // model points in item coords and their bounds, cached so
+    // paint does not lock the model per point
+    QPolygonF points_;
+    QRectF bounds_;
+    // points decimated for zoom they were drawn at
+    QPolygonF lod_points_;
+    qreal lod_scale_;
+    void snapshotPoints();
     QMutex mutex_;  // mutex lock for compute thread setting color
     qreal getScalingFactor() const;
 };
@@ -16,10 +16,12 @@
 #include <QHeaderView>
 #include <QGestureEvent>
 #include <QDoubleSpinBox>
+#include <QTimer>
 
 #include "algorithm.h"
 
 #include "include/graphics/canvas.h"
+#include "include/graphics/frame_timing.h"
 #include "include/window/menu_panel.h"
 #include "include/globals.h"
 #include "include/controls/controller.h"
@@ -27,6 +29,8 @@
 namespace optgui {
 
 const qreal DOT_SIZE = 14;
+// multisamples of OpenGL viewport for antialiased edges
+const int VIEW_OPENGL_SAMPLES = 4;
 
 class View : public QGraphicsView {
     Q_OBJECT
@@ -42,6 +46,10 @@ class View : public QGraphicsView {
     void resizeEvent(QResizeEvent *event) override;
     // handle mouse input for toggle mode
     void mousePressEvent(QMouseEvent *event) override;
+    // time rendering of each frame
+    void paintEvent(QPaintEvent *event) override;
+    // repaint whole view when panning moves scale bar
+    void scrollContentsBy(int dx, int dy) override;
 
  private slots:
     // open/close side menu
@@ -73,6 +81,8 @@ class View : public QGraphicsView {
 
     // set final time
     void setFinaltime(qreal final_time);
+    // show final time of free final time solve
+    void showSolvedFinaltime(qreal final_time);
 
     // duplicate currently selected item
     void duplicateSelected();
@@ -90,11 +100,17 @@ class View : public QGraphicsView {
 
     // update user feedback box message
     void updateFeedbackMessage();
+    // update solve timing of current drone in expert panel
+    void updateSolveTiming();
+    // update render timing of recent frames in expert panel
+    void updateFrameTiming();
     void setCurrEndpoints();
     void toggleSim(int);
     void toggleTrajLock(int);
     void toggleFreeFinalTime(int);
     void toggleDataCapture(int);
+    // render with OpenGL viewport instead of raster widget
+    void toggleOpenGL(int);
 
   private:
     void initializeMenuPanel();
@@ -140,10 +156,15 @@ class View : public QGraphicsView {
     quint32 a_max_row;
     quint32 wp_idx_row;
     QTableWidget *model_params_table_;
+    QTableWidget *solve_timing_table_;
+    // render timing of recent frames, shown with solve timing
+    FrameTiming frame_timing_;
+    QTimer *frame_timing_timer_;
 
     // keep track of all widgets to delete them
     QVector<QWidget *> panel_widgets_;
     QDoubleSpinBox *zoom_slider_;
+    QDoubleSpinBox *finaltime_box_;
     // keep track of all toggle buttons to set them to toggled
     // or untoggled, deleted with panel_widgets_
     QVector<MenuButton *> toggle_buttons_;
@@ -169,8 +190,11 @@ class View : public QGraphicsView {
     // expert panel skyefly params
     void initializeSkyeFlyParamsTable(MenuPanel *panel);
     void initializeDataCaptureToggle(MenuPanel *panel);
+    void initializeOpenGLToggle(MenuPanel *panel);
     // expert panel constraint_model params not in skyefly
     void initializeModelParamsTable(MenuPanel *panel);
+    // expert panel solve timing of current drone
+    void initializeSolveTimingTable(MenuPanel *panel);
 };
 
 }  // namespace optgui
@@ -13,6 +13,9 @@
 #include <QPointF>
 #include <QMutex>
 #include <QTableWidget>
+#include <QByteArray>
+
+#include <memory>
 
 #include "cprs.h"
 #include "algorithm.h"
@@ -25,6 +28,8 @@
 #include "include/models/plane_model_item.h"
 #include "include/models/path_model_item.h"
 #include "include/models/drone_model_item.h"
+#include "include/models/model_generation.h"
+#include "include/models/constraint_snapshot.h"
 
 namespace optgui {
 
@@ -60,9 +65,9 @@ class ConstraintModel {
 
     void setPathStagedModel(PathModelItem *model);
     void setPathStagedPoints(QVector<QPointF> points);
-    // remove first point from staged traj, return whether
-    // traj still has points
-    bool tickPathStaged();
+    // remove passed points from front of staged traj
+    // until at most size points remain
+    void trimPathStaged(quint32 size);
     // clear staged traj
     void clearPathStagedPoints();
     // get copy of staged traj points
@@ -79,6 +84,9 @@ class ConstraintModel {
     // functions for final time
     qreal getFinaltime();
     void setFinaltime(qreal finaltime);
+    // store final time of a free final time solve without
+    // flagging solver inputs as changed
+    void setSolvedFinaltime(qreal finaltime);
 
     // functions for granularity of trajectory
     quint32 getHorizon();
@@ -90,10 +98,12 @@ class ConstraintModel {
 
     autogen::packet::traj3dof getCurrTraj3dof(DroneModelItem *drone);
     void setCurrTraj3dof(DroneModelItem *drone,
-                         autogen::packet::traj3dof traj3dof_data);
+                         autogen::packet::traj3dof const &traj3dof_data);
 
     // functions for staged traj network packet
     autogen::packet::traj3dof getStagedTraj3dof();
+    // serialized staged traj, shared by every send
+    QByteArray getStagedTrajDatagram();
     bool getIsTrajStaged();
     DroneModelItem *getStagedDrone();
 
@@ -121,9 +131,6 @@ class ConstraintModel {
     // functions for valid input detection
     INPUT_CODE getIsValidInput();
     bool setIsValidInput(INPUT_CODE code);
-    // calculate regions for ellipses to use for
-    // overlap detection
-    QVector<QRegion> getEllipseRegions();
     // mark overlapping ellipses as red
     void updateEllipseColors();
 
@@ -134,18 +141,30 @@ class ConstraintModel {
     bool isCurrDrone(DroneModelItem *drone);
     DroneModelItem *getCurrDrone();
 
-    // funtions for loading data into a skyenet params
-    void loadWaypointConstraints(skyenet::params *P,
-                                 double wp[skyenet::MAX_WAYPOINTS][3]);
-    void loadEllipseConstraints(skyenet::params *P);
-    void loadPosConstraints(skyenet::params *P);
+    // get consistent copy of solver inputs, lock free unless
+    // model changed since the last snapshot was published
+    std::shared_ptr<ConstraintSnapshot const> getSnapshot();
+
+    // functions for waking compute threads when solver inputs change,
+    // do not lock model so threads can wait without blocking gui
+    quint64 getGeneration();
+    quint64 getWakeups();
+    void waitForChange(quint64 wakeups, unsigned long msecs);
+    void wakeComputeThreads();
 
 private:
     QMutex model_lock_;
+    // counter bumped on every change to solver inputs
+    ModelGeneration generation_;
+    // latest published solver inputs, read and written atomically
+    std::shared_ptr<ConstraintSnapshot const> snapshot_;
 
     // skyenet params
     skyenet::params P_;
     autogen::packet::traj3dof drone_staged_traj3dof_data_;
+    // staged traj serialized once when staged, implicitly shared
+    // with sockets so sends do not copy it
+    QByteArray staged_traj_datagram_;
 
     // input and feasibility status
     INPUT_CODE input_code_;
@@ -175,8 +194,14 @@ private:
     DroneModelItem *curr_drone_;
 
     // Convert constraints to skyefly params
+    void buildSnapshot(ConstraintSnapshot *snapshot);
+    QVector<EllipseGeometry> getEllipseGeometries();
+    void loadWaypointConstraints(skyenet::params *P,
+                                 double wp[skyenet::MAX_WAYPOINTS][3]);
+    void loadEllipseConstraints(skyenet::params *P);
+    void loadPosConstraints(skyenet::params *P);
     void loadPlaneConstraint(skyenet::params *P, quint32 index,
-                                 QVector3D p, QVector3D q);
+                             PlaneConstraintRow const &row);
     int distributeWpEvenly(skyenet::params *P, int index, int remaining,
                          int low, int high);
 };
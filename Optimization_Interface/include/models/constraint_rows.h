@@ -0,0 +1,83 @@
+// TITLE:   Optimization_Interface/include/models/constraint_rows.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Solver space constraint rows cached by constraint data models
+
+#ifndef CONSTRAINT_ROWS_H_
+#define CONSTRAINT_ROWS_H_
+
+#include <QPointF>
+#include <QLineF>
+#include <QVector3D>
+#include <QtMath>
+
+#include "include/globals.h"
+
+namespace optgui {
+
+// ellipse obstacle in meters, loaded into skyenet obs
+struct EllipseConstraintRow {
+    double M0[2];
+    double M1[2];
+    double c_x;
+    double c_y;
+};
+
+// half plane in meters, loaded into skyenet cpos
+struct PlaneConstraintRow {
+    double A[2];
+    double b;
+};
+
+inline EllipseConstraintRow ellipseConstraintRow(QPointF const &pos,
+                                                 qreal height, qreal width,
+                                                 qreal rot, qreal clearance) {
+    // calculate ellipse matrix in meters
+    EllipseConstraintRow row;
+    qreal a = (height / GRID_SIZE) + clearance;
+    qreal inv_a = 1.0 / a;
+    qreal b = (width / GRID_SIZE) + clearance;
+    qreal inv_b = 1.0 / b;
+    qreal sin_t = qSin(qDegreesToRadians(rot));
+    qreal cos_t = qCos(qDegreesToRadians(rot));
+    qreal cos_t_2 = cos_t * cos_t;
+    qreal sin_t_2 = sin_t * sin_t;
+
+    row.M0[0] = (inv_a * cos_t_2) + (inv_b * sin_t_2);
+    row.M0[1] = (inv_a * sin_t * cos_t) - (inv_b * sin_t * cos_t);
+    row.M1[0] = (inv_a * sin_t * cos_t) - (inv_b * sin_t * cos_t);
+    row.M1[1] = (inv_a * sin_t_2) + (inv_b * cos_t_2);
+
+    QVector3D xyz_coords = guiXyzToXyz(pos.x(), pos.y(), 0);
+    row.c_x = xyz_coords.x();
+    row.c_y = xyz_coords.y();
+    return row;
+}
+
+inline PlaneConstraintRow planeConstraintRow(QPointF const &p_pos,
+                                             QPointF const &q_pos) {
+    // calculate half plane through p and q in meters
+    PlaneConstraintRow row;
+    QVector3D xyz_p = guiXyzToXyz(p_pos.x(), p_pos.y(), 0);
+    QVector3D xyz_q = guiXyzToXyz(q_pos.x(), q_pos.y(), 0);
+    qreal c = ((xyz_q.x() * xyz_p.y()) - (xyz_q.y() * xyz_p.x()));
+
+    qreal a1 = (xyz_q.x() - xyz_p.x()) / c;
+    qreal a2 = (xyz_q.y() - xyz_p.y()) / c * -1.0;
+
+    QLineF line(QPointF(xyz_q.x(), xyz_q.y()),
+                QPointF(xyz_p.x(), xyz_p.y()));
+    QPointF normal = line.normalVector().p2();
+    qreal flip = ((a1 * normal.y()) + (a2 * normal.x()) < 1) ? -1 : 1;
+
+    row.A[0] = flip * a1;
+    row.A[1] = flip * a2;
+    row.b = flip;
+    return row;
+}
+
+}  // namespace optgui
+
+#endif  // CONSTRAINT_ROWS_H_
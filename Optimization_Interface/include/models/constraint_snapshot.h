@@ -0,0 +1,37 @@
+// TITLE:   Optimization_Interface/include/models/constraint_snapshot.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Immutable copy of solver inputs published by the constraint model
+
+#ifndef CONSTRAINT_SNAPSHOT_H_
+#define CONSTRAINT_SNAPSHOT_H_
+
+
+#include "cprs.h"
+#include "algorithm.h"
+
+#include "include/models/ellipse_index.h"
+
+namespace optgui {
+
+struct ConstraintSnapshot {
+    ConstraintSnapshot() : generation(0), P(), wp(),
+        ellipse_index(), is_free_final_time(false) {}
+
+    // model generation the snapshot was built from
+    quint64 generation;
+    // params with ellipse, position and waypoint constraints loaded
+    skyenet::params P;
+    // waypoint positions in meters
+    double wp[skyenet::MAX_WAYPOINTS][3];
+    // ellipses around obstacles for overlap detection
+    EllipseIndex ellipse_index;
+    // flag for solving free final time
+    bool is_free_final_time;
+};
+
+}  // namespace optgui
+
+#endif  // CONSTRAINT_SNAPSHOT_H_
@@ -10,16 +10,42 @@
 
 #include <QtMath>
 
+#include "include/models/model_generation.h"
+
 namespace optgui {
 
 class DataModel {
  public:
     // default initialize port to 0
-    DataModel() : port_(0) {}
+    DataModel() : port_(0), generation_(nullptr) {}
     virtual ~DataModel() {}
 
     // network port
     quint16 port_;
+
+    // set change counter of owning constraint model,
+    // nullptr when not owned by a constraint model
+    void setGeneration(ModelGeneration *generation) {
+        this->generation_ = generation;
+    }
+
+ protected:
+    // flag solver inputs as changed
+    void bumpGeneration() {
+        if (this->generation_) {
+            this->generation_->bump();
+        }
+    }
+
+    // wake compute threads without changing scene
+    void wakeGeneration() {
+        if (this->generation_) {
+            this->generation_->wake();
+        }
+    }
+
+ private:
+    ModelGeneration *generation_;
 };
 
 }  // namespace optgui
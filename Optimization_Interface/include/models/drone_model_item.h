@@ -14,18 +14,27 @@
 #include <QMutex>
 
 #include "include/models/data_model.h"
+#include "include/models/seq_lock.h"
 
 #include "include/globals.h"
 
 namespace optgui {
 
+// full telemetry state published to readers as one sample
+struct DroneState {
+    QVector3D pos;
+    QVector3D vel;
+    QVector3D accel;
+    // monotonic time of update in nanoseconds
+    qint64 stamp_nsecs;
+    // incremented on every state update
+    quint64 generation;
+};
+
 class DroneModelItem : public DataModel {
  public:
-    explicit DroneModelItem(QPointF const &pos) : mutex_() {
-        this->pos_ = QVector3D(pos.x(), pos.y(), 0);
-        this->vel_ = QVector3D(0, 0, 0);
-        // counteract gravity
-        this->accel_ = QVector3D(0, 0, 9.81 * GRID_SIZE);
+    explicit DroneModelItem(QPointF const &pos) : write_mutex_(),
+        state_(initialState(pos)) {
         port_ = 0;
         destination_port_ = 6000;
         ip_addr_ = "0.0.0.0";
@@ -33,40 +42,65 @@ class DroneModelItem : public DataModel {
 
     ~DroneModelItem() {
         // acquire lock to destroy it
-        QMutexLocker locker(&this->mutex_);
+        QMutexLocker locker(&this->write_mutex_);
     }
 
-    QVector3D getPos() {
-        QMutexLocker locker(&this->mutex_);
+    DroneState getState() const {
+        // get consistent copy of full state without locking
+        return this->state_.load();
+    }
+
+    QVector3D getPos() const {
         // get copy of pos
-        return this->pos_;
+        return this->state_.load().pos;
     }
 
     void setPos(QVector3D pos) {
-        QMutexLocker locker(&this->mutex_);
-        this->pos_ = pos;
+        QMutexLocker locker(&this->write_mutex_);
+        DroneState state = this->state_.load();
+        state.pos = pos;
+        this->publish(&state, monotonicNsecs());
     }
 
-    QVector3D getVel() {
-        QMutexLocker locker(&this->mutex_);
+    QVector3D getVel() const {
         // get copy of velocity
-        return this->vel_;
+        return this->state_.load().vel;
     }
 
     void setVel(QVector3D vel) {
-        QMutexLocker locker(&this->mutex_);
-        this->vel_ = vel;
+        QMutexLocker locker(&this->write_mutex_);
+        DroneState state = this->state_.load();
+        state.vel = vel;
+        this->publish(&state, monotonicNsecs());
     }
 
-    QVector3D getAccel() {
-        QMutexLocker locker(&this->mutex_);
+    QVector3D getAccel() const {
         // get copy of acceleration
-        return this->accel_;
+        return this->state_.load().accel;
     }
 
     void setAccel(QVector3D accel) {
-        QMutexLocker locker(&this->mutex_);
-        this->accel_ = accel;
+        QMutexLocker locker(&this->write_mutex_);
+        DroneState state = this->state_.load();
+        state.accel = accel;
+        this->publish(&state, monotonicNsecs());
+    }
+
+    void setState(QVector3D pos, QVector3D vel, QVector3D accel,
+                  qint64 stamp_nsecs) {
+        QMutexLocker locker(&this->write_mutex_);
+        // set full telemetry state as one update,
+        // stamped with monotonic receipt time
+        DroneState state = this->state_.load();
+        state.pos = pos;
+        state.vel = vel;
+        state.accel = accel;
+        this->publish(&state, stamp_nsecs);
+    }
+
+    quint64 getStateGeneration() const {
+        // get number of state updates, used to detect new telemetry
+        return this->state_.load().generation;
     }
 
     // IP addr of drone
@@ -75,11 +109,30 @@ class DroneModelItem : public DataModel {
     quint16 destination_port_;
 
  private:
-    // mutex lock for getters/setters
-    QMutex mutex_;
-    QVector3D pos_;
-    QVector3D vel_;
-    QVector3D accel_;
+    // mutex lock serializing setters, getters do not lock
+    QMutex write_mutex_;
+    // state read by solvers, GUI, and sockets
+    SeqLock<DroneState> state_;
+
+    static DroneState initialState(QPointF const &pos) {
+        DroneState state;
+        state.pos = QVector3D(pos.x(), pos.y(), 0);
+        state.vel = QVector3D(0, 0, 0);
+        // counteract gravity
+        state.accel = QVector3D(0, 0, 9.81 * GRID_SIZE);
+        state.stamp_nsecs = monotonicNsecs();
+        state.generation = 0;
+        return state;
+    }
+
+    void publish(DroneState *state, qint64 stamp_nsecs) {
+        // stamp and publish state, caller holds write lock
+        state->stamp_nsecs = stamp_nsecs;
+        state->generation++;
+        this->state_.store(*state);
+        // wake compute threads
+        this->wakeGeneration();
+    }
 };
 
 }  // namespace optgui
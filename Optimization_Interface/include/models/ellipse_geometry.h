@@ -0,0 +1,156 @@
+// TITLE:   Optimization_Interface/include/models/ellipse_geometry.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Closed form ellipse obstacle geometry for input validation
+
+#ifndef ELLIPSE_GEOMETRY_H_
+#define ELLIPSE_GEOMETRY_H_
+
+#include <QPointF>
+#include <QRectF>
+#include <QtMath>
+
+#include <algorithm>
+#include <cmath>
+
+namespace optgui {
+
+// max bisection steps when finding closest point on ellipse,
+// enough to reach double precision
+quint32 const ELLIPSE_ROOT_MAX_ITER = 1074;
+
+// distance from point (y0, y1) in first quadrant to ellipse with
+// semi axes e0 >= e1 > 0 centered at origin and aligned with axes
+inline qreal ellipsePointDistance(qreal e0, qreal e1, qreal y0, qreal y1) {
+    if (y1 > 0) {
+        if (y0 > 0) {
+            // find root of closest point equation by bisection
+            qreal z0 = y0 / e0;
+            qreal z1 = y1 / e1;
+            qreal g = (z0 * z0) + (z1 * z1) - 1;
+            if (g == 0) return 0;
+            qreal r0 = (e0 / e1) * (e0 / e1);
+            qreal n0 = r0 * z0;
+            qreal s0 = z1 - 1;
+            qreal s1 = (g < 0) ? 0 : std::hypot(n0, z1) - 1;
+            qreal s = 0;
+            for (quint32 i = 0; i < ELLIPSE_ROOT_MAX_ITER; i++) {
+                s = (s0 + s1) / 2;
+                if (s == s0 || s == s1) break;
+                qreal ratio0 = n0 / (s + r0);
+                qreal ratio1 = z1 / (s + 1);
+                g = (ratio0 * ratio0) + (ratio1 * ratio1) - 1;
+                if (g > 0) {
+                    s0 = s;
+                } else if (g < 0) {
+                    s1 = s;
+                } else {
+                    break;
+                }
+            }
+            qreal x0 = (r0 * y0) / (s + r0);
+            qreal x1 = y1 / (s + 1);
+            return std::hypot(x0 - y0, x1 - y1);
+        }
+        // point on minor axis
+        return std::abs(y1 - e1);
+    }
+    // point on major axis, closest point may be off axis
+    qreal numer0 = e0 * y0;
+    qreal denom0 = (e0 * e0) - (e1 * e1);
+    if (numer0 < denom0) {
+        qreal xde0 = numer0 / denom0;
+        qreal x0 = e0 * xde0;
+        qreal x1 = e1 * std::sqrt(1 - (xde0 * xde0));
+        return std::hypot(x0 - y0, x1);
+    }
+    return std::abs(y0 - e0);
+}
+
+// ellipse around obstacle in pixels, clearance included
+struct EllipseGeometry {
+    // center in xyz pixels
+    QPointF center;
+    // semi axes along rotated x and y
+    qreal a;
+    qreal b;
+    // rotation clockwise on screen
+    qreal cos_t;
+    qreal sin_t;
+
+    EllipseGeometry() : center(), a(1), b(1), cos_t(1), sin_t(0) {}
+
+    EllipseGeometry(QPointF const &pos, qreal width, qreal height,
+                    qreal rot) : center(pos), a(width), b(height),
+        cos_t(qCos(qDegreesToRadians(rot))),
+        sin_t(qSin(qDegreesToRadians(rot))) {}
+
+    QRectF boundingRect() const {
+        // axis aligned extents of rotated ellipse
+        qreal half_w = std::hypot(this->a * this->cos_t,
+                                  this->b * this->sin_t);
+        qreal half_h = std::hypot(this->a * this->sin_t,
+                                  this->b * this->cos_t);
+        return QRectF(this->center.x() - half_w, this->center.y() - half_h,
+                      half_w * 2, half_h * 2);
+    }
+
+    bool contains(QPointF const &point) const {
+        // rotate point into ellipse axes and check implicit equation
+        qreal dx = point.x() - this->center.x();
+        qreal dy = point.y() - this->center.y();
+        qreal lx = ((dx * this->cos_t) + (dy * this->sin_t)) / this->a;
+        qreal ly = ((dy * this->cos_t) - (dx * this->sin_t)) / this->b;
+        return (lx * lx) + (ly * ly) <= 1;
+    }
+
+    bool overlaps(EllipseGeometry const &other) const {
+        // map other ellipse to unit circle at origin, this ellipse
+        // becomes {c + M u : |u| <= 1} and overlaps if it comes
+        // within distance 1 of the origin
+        qreal dx = this->center.x() - other.center.x();
+        qreal dy = this->center.y() - other.center.y();
+        qreal cx = ((dx * other.cos_t) + (dy * other.sin_t)) / other.a;
+        qreal cy = ((dy * other.cos_t) - (dx * other.sin_t)) / other.b;
+
+        // relative rotation of this ellipse in other's axes
+        qreal cos_r = (this->cos_t * other.cos_t) +
+                      (this->sin_t * other.sin_t);
+        qreal sin_r = (this->sin_t * other.cos_t) -
+                      (this->cos_t * other.sin_t);
+        qreal m00 = (cos_r * this->a) / other.a;
+        qreal m01 = (-sin_r * this->b) / other.a;
+        qreal m10 = (sin_r * this->a) / other.b;
+        qreal m11 = (cos_r * this->b) / other.b;
+
+        // principal axes of mapped ellipse from M M^T
+        qreal p = (m00 * m00) + (m01 * m01);
+        qreal q = (m00 * m10) + (m01 * m11);
+        qreal r = (m10 * m10) + (m11 * m11);
+        qreal mean = (p + r) / 2;
+        qreal diff = std::hypot((p - r) / 2, q);
+        qreal e0 = std::sqrt(mean + diff);
+        qreal e1 = std::sqrt(std::max(mean - diff, 0.0));
+        // keep degenerate ellipses finite
+        e1 = std::max(e1, e0 * 1e-12);
+        qreal phi = std::atan2(2 * q, p - r) / 2;
+        qreal cos_p = std::cos(phi);
+        qreal sin_p = std::sin(phi);
+
+        // origin relative to mapped ellipse in its axes
+        qreal y0 = std::abs((-cx * cos_p) + (-cy * sin_p));
+        qreal y1 = std::abs((cx * sin_p) - (cy * cos_p));
+
+        // origin inside mapped ellipse
+        if (((y0 / e0) * (y0 / e0)) + ((y1 / e1) * (y1 / e1)) <= 1) {
+            return true;
+        }
+        return ellipsePointDistance(e0, e1, y0, y1) <= 1;
+    }
+};
+
+}  // namespace optgui
+
+#endif  // ELLIPSE_GEOMETRY_H_
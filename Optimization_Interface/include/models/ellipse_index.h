@@ -0,0 +1,48 @@
+// TITLE:   Optimization_Interface/include/models/ellipse_index.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Uniform grid over ellipse obstacles for containment and overlap queries
+
+#ifndef ELLIPSE_INDEX_H_
+#define ELLIPSE_INDEX_H_
+
+#include <QVector>
+#include <QHash>
+#include <QPointF>
+
+#include "include/models/ellipse_geometry.h"
+
+namespace optgui {
+
+class EllipseIndex {
+ public:
+    EllipseIndex();
+
+    // rebuild grid from ellipses and check them for overlap
+    void build(QVector<EllipseGeometry> const &ellipses);
+
+    // check whether point is inside any ellipse
+    bool contains(QPointF const &point) const;
+    // check whether any two ellipses overlap
+    bool hasOverlap() const;
+
+ private:
+    QVector<EllipseGeometry> ellipses_;
+    // bounding rects of ellipses, checked before exact tests
+    QVector<QRectF> bounds_;
+    // indices of ellipses overlapping each occupied cell
+    QHash<quint64, QVector<int>> cells_;
+    // width of square cells in pixels
+    qreal cell_size_;
+    bool has_overlap_;
+
+    qint32 getCellCoord(qreal coord) const;
+    quint64 getCellKey(qint32 col, qint32 row) const;
+    bool findOverlap() const;
+};
+
+}  // namespace optgui
+
+#endif  // ELLIPSE_INDEX_H_
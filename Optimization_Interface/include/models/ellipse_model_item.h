@@ -10,10 +10,10 @@
 
 #include <QPointF>
 #include <QMutex>
-#include <QRegion>
-#include <QTransform>
 
 #include "include/models/data_model.h"
+#include "include/models/constraint_rows.h"
+#include "include/models/ellipse_geometry.h"
 #include "include/globals.h"
 
 namespace optgui {
@@ -26,12 +26,10 @@ class EllipseModelItem : public DataModel {
                 qreal height = DEFAULT_RAD,
                 qreal width = DEFAULT_RAD, qreal rot = 0) :
         DataModel(), mutex_(), height_(height), width_(width), rot_(rot),
-        direction_(false), is_overlap_(false), clearance_(clearance) {
+        direction_(false), is_overlap_(false), clearance_(clearance),
+        is_row_valid_(false) {
         // set pos from param
         this->pos_ = pos;
-        // generate region for overlap detection,
-        // only generate new region when coords change
-        this->region_ = generateRegion();
     }
 
     ~EllipseModelItem() {
@@ -48,8 +46,10 @@ class EllipseModelItem : public DataModel {
     void setWidth(qreal width) {
         QMutexLocker locker(&this->mutex_);
         this->width_ = width;
-        // update region
-        this->region_ = this->generateRegion();
+        // invalidate cached solver row
+        this->is_row_valid_ = false;
+        // flag solver inputs as changed
+        this->bumpGeneration();
     }
 
     qreal getHeight() {
@@ -61,8 +61,10 @@ class EllipseModelItem : public DataModel {
     void setHeight(qreal height) {
         QMutexLocker locker(&this->mutex_);
         this->height_ = height;
-        // update region
-        this->region_ = this->generateRegion();
+        // invalidate cached solver row
+        this->is_row_valid_ = false;
+        // flag solver inputs as changed
+        this->bumpGeneration();
     }
 
     qreal getRot() {
@@ -74,8 +76,10 @@ class EllipseModelItem : public DataModel {
     void setRot(qreal rot) {
         QMutexLocker locker(&this->mutex_);
         this->rot_ = rot;
-        // update region
-        this->region_ = this->generateRegion();
+        // invalidate cached solver row
+        this->is_row_valid_ = false;
+        // flag solver inputs as changed
+        this->bumpGeneration();
     }
 
     QPointF getPos() {
@@ -88,8 +92,10 @@ class EllipseModelItem : public DataModel {
         QMutexLocker locker(&this->mutex_);
         this->pos_.setX(pos.x());
         this->pos_.setY(pos.y());
-        // update region
-        this->region_ = this->generateRegion();
+        // invalidate cached solver row
+        this->is_row_valid_ = false;
+        // flag solver inputs as changed
+        this->bumpGeneration();
     }
 
     bool getDirection() {
@@ -114,8 +120,10 @@ class EllipseModelItem : public DataModel {
     void setClearance(qreal clearance) {
         QMutexLocker locker(&this->mutex_);
         this->clearance_ = clearance;
-        // update region
-        this->region_ = this->generateRegion();
+        // invalidate cached solver row
+        this->is_row_valid_ = false;
+        // flag solver inputs as changed
+        this->bumpGeneration();
     }
 
     bool getIsOverlap() {
@@ -128,9 +136,26 @@ class EllipseModelItem : public DataModel {
         this->is_overlap_ = is_overlap;
     }
 
-    QRegion const getRegion() {
+    EllipseGeometry getGeometry() {
         QMutexLocker locker(&this->mutex_);
-        return this->region_;
+        // get analytic ellipse around obs in pixels for
+        // overlap detection, clearance included
+        return EllipseGeometry(this->pos_,
+                               this->width_ + (this->clearance_ * GRID_SIZE),
+                               this->height_ + (this->clearance_ * GRID_SIZE),
+                               this->rot_);
+    }
+
+    EllipseConstraintRow getConstraintRow() {
+        QMutexLocker locker(&this->mutex_);
+        // recompute solver row only after a setter invalidates it
+        if (!this->is_row_valid_) {
+            this->row_ = ellipseConstraintRow(this->pos_,
+                                              this->height_, this->width_,
+                                              this->rot_, this->clearance_);
+            this->is_row_valid_ = true;
+        }
+        return this->row_;
     }
 
  private:
@@ -149,24 +174,9 @@ class EllipseModelItem : public DataModel {
     bool is_overlap_;
     // clearance in meters
     qreal clearance_;
-    // save region for detecting overlap to minimize
-    // times needed to generate
-    QRegion region_;
-
-    QRegion generateRegion() {
-        // create a QRegion to use for overlap detection
-        qreal width = this->width_ + (this->clearance_ * GRID_SIZE);
-        qreal height = this->height_ + (this->clearance_ * GRID_SIZE);
-        QRegion region = QRegion(QRect(-width, -height,
-                                       width * 2, height * 2),
-                                 QRegion::Ellipse);
-        QTransform rotation;
-        rotation.rotate(this->rot_);
-        region = rotation.map(region);
-        region.translate(this->pos_.x(), this->pos_.y());
-
-        return region;
-    }
+    // cached solver row, only regenerated when coords change
+    EllipseConstraintRow row_;
+    bool is_row_valid_;
 };
 
 }  // namespace optgui
@@ -0,0 +1,75 @@
+// TITLE:   Optimization_Interface/include/models/model_generation.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Change counter shared by constraint model and data models,
+// used to wake compute threads only when solver inputs change
+
+#ifndef MODEL_GENERATION_H_
+#define MODEL_GENERATION_H_
+
+#include <QMutex>
+#include <QWaitCondition>
+#include <QAtomicInteger>
+
+namespace optgui {
+
+class ModelGeneration {
+ public:
+    ModelGeneration() : mutex_(), changed_(), generation_(0), wakeups_(0) {}
+
+    ~ModelGeneration() {
+        // acquire lock to destroy it
+        QMutexLocker locker(&this->mutex_);
+    }
+
+    quint64 get() {
+        // get number of scene changes without locking
+        return this->generation_.loadAcquire();
+    }
+
+    void bump() {
+        QMutexLocker locker(&this->mutex_);
+        // flag scene as changed and wake waiting threads
+        this->generation_.fetchAndAddOrdered(1);
+        this->wakeups_++;
+        this->changed_.wakeAll();
+    }
+
+    void wake() {
+        QMutexLocker locker(&this->mutex_);
+        // wake waiting threads without changing scene,
+        // used for per vehicle telemetry and stopping threads
+        this->wakeups_++;
+        this->changed_.wakeAll();
+    }
+
+    quint64 getWakeups() {
+        QMutexLocker locker(&this->mutex_);
+        // get number of wakes, read before checking inputs
+        return this->wakeups_;
+    }
+
+    void wait(quint64 wakeups, unsigned long msecs) {
+        QMutexLocker locker(&this->mutex_);
+        // sleep unless woken since wakeups was read
+        if (this->wakeups_ == wakeups) {
+            this->changed_.wait(&this->mutex_, msecs);
+        }
+    }
+
+ private:
+    // mutex lock for counters and wait condition
+    QMutex mutex_;
+    QWaitCondition changed_;
+    // incremented on every scene mutation,
+    // atomic so it can be read without locking
+    QAtomicInteger<quint64> generation_;
+    // incremented on every scene mutation or wake
+    quint64 wakeups_;
+};
+
+}  // namespace optgui
+
+#endif  // MODEL_GENERATION_H_
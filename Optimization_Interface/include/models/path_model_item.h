@@ -59,6 +59,14 @@ class PathModelItem : public DataModel {
         this->points_ = points;
     }
 
+    void swapPoints(QVector<QPointF> *points) {
+        QMutexLocker locker(&this->mutex_);
+        // exchange points with caller without copying,
+        // caller gets previous points to reuse as a buffer,
+        // which may still be shared with copies from getPoints
+        this->points_.swap(*points);
+    }
+
     void addPoint(QPointF point) {
         QMutexLocker locker(&this->mutex_);
         // append point to traj
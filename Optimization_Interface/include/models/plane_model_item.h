@@ -12,13 +12,14 @@
 #include <QMutex>
 
 #include "include/models/data_model.h"
+#include "include/models/constraint_rows.h"
 
 namespace optgui {
 
 class PlaneModelItem : public DataModel {
  public:
     explicit PlaneModelItem(QPointF p1, QPointF p2) : DataModel(),
-        mutex_(), direction_(false) {
+        mutex_(), direction_(false), is_row_valid_(false) {
         // set points from params
         p1_ = p1;
         p2_ = p2;
@@ -40,6 +41,10 @@ class PlaneModelItem : public DataModel {
         // set first point in xyz pixels
         this->p1_.setX(pos.x());
         this->p1_.setY(pos.y());
+        // invalidate cached solver row
+        this->is_row_valid_ = false;
+        // flag solver inputs as changed
+        this->bumpGeneration();
     }
 
     QPointF getP2() {
@@ -53,6 +58,10 @@ class PlaneModelItem : public DataModel {
         // get copy of second point in xyz pixels
         this->p2_.setX(pos.x());
         this->p2_.setY(pos.y());
+        // invalidate cached solver row
+        this->is_row_valid_ = false;
+        // flag solver inputs as changed
+        this->bumpGeneration();
     }
 
     bool getDirection() {
@@ -61,10 +70,29 @@ class PlaneModelItem : public DataModel {
         return this->direction_;
     }
 
+    PlaneConstraintRow getConstraintRow() {
+        QMutexLocker locker(&this->mutex_);
+        // recompute solver row only after a setter invalidates it
+        if (!this->is_row_valid_) {
+            // choose direction of constraint
+            if (this->direction_) {
+                this->row_ = planeConstraintRow(this->p1_, this->p2_);
+            } else {
+                this->row_ = planeConstraintRow(this->p2_, this->p1_);
+            }
+            this->is_row_valid_ = true;
+        }
+        return this->row_;
+    }
+
     void flipDirection() {
         QMutexLocker locker(&this->mutex_);
         // flip direction of constraint
         this->direction_ = !this->direction_;
+        // invalidate cached solver row
+        this->is_row_valid_ = false;
+        // flag solver inputs as changed
+        this->bumpGeneration();
     }
 
  private:
@@ -75,6 +103,9 @@ class PlaneModelItem : public DataModel {
     QPointF p2_;
     // direction of constraint inequality
     bool direction_;
+    // cached solver row, only regenerated when points change
+    PlaneConstraintRow row_;
+    bool is_row_valid_;
 };
 
 }  // namespace optgui
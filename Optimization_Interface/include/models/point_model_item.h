@@ -37,6 +37,8 @@ class PointModelItem : public DataModel {
         QMutexLocker locker(&this->mutex_);
         this->pos_.setX(pos.x());
         this->pos_.setY(pos.y());
+        // flag solver inputs as changed
+        this->bumpGeneration();
     }
 
  private:
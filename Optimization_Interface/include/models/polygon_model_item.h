@@ -13,13 +13,14 @@
 #include <QMutex>
 
 #include "include/models/data_model.h"
+#include "include/models/constraint_rows.h"
 
 namespace optgui {
 
 class PolygonModelItem : public DataModel {
  public:
     explicit PolygonModelItem(QVector<QPointF> points) : DataModel(),
-        mutex_(), direction_(false) {
+        mutex_(), direction_(false), rows_(), is_row_valid_(false) {
         // initialize from copy of points param
         points_ = points;
     }
@@ -41,6 +42,10 @@ class PolygonModelItem : public DataModel {
         QPointF &temp = this->points_[index];
         temp.setX(point.x());
         temp.setY(point.y());
+        // invalidate cached solver rows
+        this->is_row_valid_ = false;
+        // flag solver inputs as changed
+        this->bumpGeneration();
     }
 
     QPointF getPointAt(quint32 index) {
@@ -59,6 +64,33 @@ class PolygonModelItem : public DataModel {
         QMutexLocker locker(&this->mutex_);
         // flip direction of constraint inequality
         this->direction_ = !this->direction_;
+        // invalidate cached solver rows
+        this->is_row_valid_ = false;
+        // flag solver inputs as changed
+        this->bumpGeneration();
+    }
+
+    QVector<PlaneConstraintRow> getConstraintRows() {
+        QMutexLocker locker(&this->mutex_);
+        // recompute solver rows for each edge only after a
+        // setter invalidates them
+        if (!this->is_row_valid_) {
+            quint32 size = this->points_.size();
+            this->rows_.resize(size);
+            for (quint32 i = 1; i < size + 1; i++) {
+                QPointF p_pos = this->points_.at(i - 1);
+                QPointF q_pos = this->points_.at(i % size);
+                // choose direction of constraint
+                if (this->direction_) {
+                    this->rows_[i - 1] = planeConstraintRow(p_pos, q_pos);
+                } else {
+                    this->rows_[i - 1] = planeConstraintRow(q_pos, p_pos);
+                }
+            }
+            this->is_row_valid_ = true;
+        }
+        // implicitly shared, copy is cheap until rows change
+        return this->rows_;
     }
 
     bool isConvex() {
@@ -96,6 +128,10 @@ class PolygonModelItem : public DataModel {
     QMutex mutex_;
     QVector<QPointF> points_;
     bool direction_;
+    // cached solver rows for each edge, only regenerated
+    // when points change
+    QVector<PlaneConstraintRow> rows_;
+    bool is_row_valid_;
 };
 
 }  // namespace optgui
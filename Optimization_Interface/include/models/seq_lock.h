@@ -0,0 +1,81 @@
+// TITLE:   Optimization_Interface/include/models/seq_lock.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Sequence lock publishing a small value to readers without
+// blocking, readers retry if a write overlapped their copy
+
+#ifndef SEQ_LOCK_H_
+#define SEQ_LOCK_H_
+
+#include <QtGlobal>
+
+#include <atomic>
+#include <cstring>
+#include <type_traits>
+
+namespace optgui {
+
+template <typename T>
+class SeqLock {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "SeqLock value must be trivially copyable");
+
+ public:
+    explicit SeqLock(T const &value) : sequence_(0) {
+        this->copyIn(value);
+    }
+
+    T load() const {
+        // retry until copy taken between two equal even sequences
+        T value;
+        quint64 before;
+        quint64 after;
+        do {
+            before = this->sequence_.load(std::memory_order_acquire);
+            this->copyOut(&value);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            after = this->sequence_.load(std::memory_order_relaxed);
+        } while ((before & 1) || before != after);
+        return value;
+    }
+
+    // writers must be serialized by caller
+    void store(T const &value) {
+        // odd sequence marks write in progress
+        quint64 sequence = this->sequence_.load(std::memory_order_relaxed);
+        this->sequence_.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        this->copyIn(value);
+        this->sequence_.store(sequence + 2, std::memory_order_release);
+    }
+
+ private:
+    // value stored as atomic words so racing copies are defined
+    static int const NUM_WORDS = (sizeof(T) + sizeof(quint64) - 1)
+                                 / sizeof(quint64);
+
+    std::atomic<quint64> sequence_;
+    std::atomic<quint64> words_[NUM_WORDS];
+
+    void copyIn(T const &value) {
+        quint64 words[NUM_WORDS] = { 0 };
+        std::memcpy(words, &value, sizeof(T));
+        for (int i = 0; i < NUM_WORDS; i++) {
+            this->words_[i].store(words[i], std::memory_order_relaxed);
+        }
+    }
+
+    void copyOut(T *value) const {
+        quint64 words[NUM_WORDS];
+        for (int i = 0; i < NUM_WORDS; i++) {
+            words[i] = this->words_[i].load(std::memory_order_relaxed);
+        }
+        std::memcpy(value, words, sizeof(T));
+    }
+};
+
+}  // namespace optgui
+
+#endif  // SEQ_LOCK_H_
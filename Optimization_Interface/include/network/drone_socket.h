@@ -13,19 +13,36 @@
 #include "autogen/lib.h"
 
 #include "include/graphics/drone_graphics_item.h"
+#include "include/network/traj_uplink.h"
+#include "include/controls/flight_recorder.h"
+#include "include/controls/flight_record_queue.h"
 
 namespace optgui {
 
+// max size of received telemetry datagram
+qint64 const DRONE_SOCKET_BUFFER_SIZE = 4000;
+
 class DroneSocket : public QUdpSocket {
     Q_OBJECT
 
  public:
-    explicit DroneSocket(DroneGraphicsItem *item, QObject *parent = nullptr);
+    // chunked sends trajectories in acknowledged chunks,
+    // every telemetry packet is pushed to records if not null
+    explicit DroneSocket(DroneGraphicsItem *item, bool is_chunked = false,
+                         FlightRecordQueue *records = nullptr,
+                         QObject *parent = nullptr);
     ~DroneSocket();
 
     // graphic item to manipulate over network
     DroneGraphicsItem *drone_item_;
 
+    // send serialized trajectory from socket to vehicle
+    // destination address in one datagram, or through
+    // uplink in chunks if not null
+    static void writeTrajectory(QUdpSocket *socket, DroneModelItem *drone,
+                                QByteArray const &datagram,
+                                TrajUplink *uplink);
+
  private slots:
     // automatically read incoming data with slots
     void readPendingDatagrams();
@@ -35,12 +52,22 @@ class DroneSocket : public QUdpSocket {
     void refresh_graphics();
 
  public slots:
-    void rx_trajectory(DroneModelItem *drone,
-                       const autogen::packet::traj3dof data);
+    // send serialized staged traj if vehicle is handled by socket
+    void rx_trajectory(DroneModelItem *drone, QByteArray datagram);
 
  private:
+    // receive buffer reused for every datagram, bytes past
+    // buffer_used_ are always zero
+    char buffer_[DRONE_SOCKET_BUFFER_SIZE];
+    qint64 buffer_used_;
+    // chunked trajectory sender, null if sending whole datagrams
+    TrajUplink *uplink_;
+    // flight record queue shared by network thread sockets,
+    // owned by controller
+    FlightRecordQueue *records_;
+
     // check if destination address is valid
-    bool isDestinationAddrValid();
+    static bool isDestinationAddrValid(DroneModelItem *drone);
 };
 
 }  // namespace optgui
@@ -0,0 +1,116 @@
+// TITLE:   Optimization_Interface/include/network/mux_socket.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Single UDP socket receiving telemetry for all networked objects,
+// datagrams are routed to data models by object id
+
+#ifndef MUX_SOCKET_H_
+#define MUX_SOCKET_H_
+
+#include <QUdpSocket>
+#include <QHash>
+#include <QMutex>
+#include <QVector3D>
+
+#include "autogen/lib.h"
+
+#include "include/graphics/canvas.h"
+#include "include/network/traj_uplink.h"
+#include "include/controls/flight_recorder.h"
+#include "include/controls/flight_record_queue.h"
+
+namespace optgui {
+
+// default listening port for multiplexed telemetry
+quint16 const MUX_SOCKET_DEFAULT_PORT = 7000;
+// max size of received datagram, id header included
+qint64 const MUX_SOCKET_BUFFER_SIZE = 4002;
+// big endian object id preceding serialized telemetry,
+// id is the port configured for the object
+qint64 const MUX_HEADER_SIZE = 2;
+
+enum MUX_ROUTE {
+    DRONE_ROUTE,
+    TARGET_ROUTE,
+    WAYPOINT_ROUTE,
+    ELLIPSE_ROUTE
+};
+
+// graphic and data model an object id is routed to
+struct MuxRoute {
+    MUX_ROUTE type;
+    QGraphicsItem *item;
+    DataModel *model;
+};
+
+// newest telemetry in gui coords received for an object in a drain
+struct MuxTelemetry {
+    QVector3D pos;
+    QVector3D vel;
+    QVector3D accel;
+    qint64 stamp_nsecs;
+};
+
+class MuxSocket : public QUdpSocket {
+    Q_OBJECT
+
+ public:
+    // listen on port and route every object in canvas with a
+    // configured port, chunked sends trajectories in acknowledged
+    // chunks, every vehicle telemetry packet is pushed to records
+    // if not null
+    MuxSocket(Canvas *canvas, quint16 port, bool is_chunked = false,
+              FlightRecordQueue *records = nullptr,
+              QObject *parent = nullptr);
+    ~MuxSocket();
+
+    // stop routing to data model, call before deleting it
+    void removeRoute(DataModel *model);
+    // set graphics coords from routed models, call from GUI thread
+    void syncGraphics();
+
+ signals:
+    // signal to re-render routed objects
+    void refresh_graphics();
+
+ public slots:
+    // send serialized staged traj if vehicle is handled by socket
+    void rx_trajectory(DroneModelItem *drone, QByteArray datagram);
+
+ private slots:
+    // automatically read incoming data with slots
+    void readPendingDatagrams();
+
+ private:
+    // mutex lock for routes, held only for lookups and updates,
+    // never across socket reads
+    QMutex mutex_;
+    // object id to route
+    QHash<quint16, MuxRoute> routes_;
+
+    // receive buffer reused for every datagram, bytes past
+    // buffer_used_ are always zero
+    char buffer_[MUX_SOCKET_BUFFER_SIZE];
+    qint64 buffer_used_;
+    // newest telemetry per object id in current drain, applied
+    // once per object after the drain
+    QHash<quint16, MuxTelemetry> pending_;
+
+    // chunked trajectory senders by vehicle id, created on first
+    // send and only used on network thread
+    bool is_chunked_;
+    QHash<quint16, TrajUplink *> uplinks_;
+    // flight record queue shared by network thread sockets,
+    // owned by controller
+    FlightRecordQueue *records_;
+
+    void addRoute(MUX_ROUTE type, QGraphicsItem *item, DataModel *model);
+    // apply telemetry in gui coords to routed data model
+    void dispatch(MuxRoute const &route, MuxTelemetry const &telemetry);
+};
+
+}  // namespace optgui
+
+#endif  // MUX_SOCKET_H_
@@ -0,0 +1,44 @@
+// TITLE:   Optimization_Interface/include/network/network_thread.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Event loop thread for all UDP sockets, keeps datagram
+// reads and trajectory sends off the GUI thread
+
+#ifndef NETWORK_THREAD_H_
+#define NETWORK_THREAD_H_
+
+#include <QThread>
+#include <QUdpSocket>
+
+namespace optgui {
+
+// deletes sockets from inside the network thread
+class SocketCloser : public QObject {
+    Q_OBJECT
+
+ public slots:
+    void closeSocket(QObject *socket);
+};
+
+class NetworkThread : public QThread {
+    Q_OBJECT
+
+ public:
+    explicit NetworkThread(QObject *parent = nullptr);
+    ~NetworkThread();
+
+    // move socket without parent onto network event loop
+    void addSocket(QUdpSocket *socket);
+    // delete socket on network event loop, blocks until
+    // socket can no longer read into its model
+    void removeSocket(QUdpSocket *socket);
+
+ private:
+    SocketCloser *closer_;
+};
+
+}  // namespace optgui
+
+#endif  // NETWORK_THREAD_H_
@@ -0,0 +1,82 @@
+// TITLE:   Optimization_Interface/include/network/traj_chunk.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Wire format of chunked trajectory uplink, a serialized traj3dof
+// is split into numbered chunks each acknowledged by the vehicle
+
+#ifndef TRAJ_CHUNK_H_
+#define TRAJ_CHUNK_H_
+
+#include <QtEndian>
+#include <QtGlobal>
+
+namespace optgui {
+
+// "TRJC" and "TRJA" in ascii
+quint32 const TRAJ_CHUNK_MAGIC = 0x54524A43;
+quint32 const TRAJ_ACK_MAGIC = 0x54524A41;
+// magic, transfer, index, count, payload length
+qint64 const TRAJ_CHUNK_HEADER_SIZE = 12;
+// magic, transfer, index
+qint64 const TRAJ_ACK_SIZE = 8;
+// max serialized traj bytes per chunk, keeps datagrams under
+// ethernet MTU so they are never fragmented
+qint64 const TRAJ_CHUNK_PAYLOAD_SIZE = 1200;
+
+// all fields big endian on the wire
+struct TrajChunkHeader {
+    // incremented for every trajectory sent
+    quint16 transfer;
+    quint16 index;
+    quint16 count;
+    quint16 length;
+};
+
+inline void writeTrajChunkHeader(TrajChunkHeader const &header,
+                                 char *data) {
+    uchar *dst = reinterpret_cast<uchar *>(data);
+    qToBigEndian<quint32>(TRAJ_CHUNK_MAGIC, dst);
+    qToBigEndian<quint16>(header.transfer, dst + 4);
+    qToBigEndian<quint16>(header.index, dst + 6);
+    qToBigEndian<quint16>(header.count, dst + 8);
+    qToBigEndian<quint16>(header.length, dst + 10);
+}
+
+inline bool readTrajChunkHeader(char const *data, qint64 size,
+                                TrajChunkHeader *header) {
+    // reject anything not a complete chunk
+    if (size < TRAJ_CHUNK_HEADER_SIZE) return false;
+    uchar const *src = reinterpret_cast<uchar const *>(data);
+    if (qFromBigEndian<quint32>(src) != TRAJ_CHUNK_MAGIC) return false;
+    header->transfer = qFromBigEndian<quint16>(src + 4);
+    header->index = qFromBigEndian<quint16>(src + 6);
+    header->count = qFromBigEndian<quint16>(src + 8);
+    header->length = qFromBigEndian<quint16>(src + 10);
+    return header->index < header->count &&
+            header->length <= TRAJ_CHUNK_PAYLOAD_SIZE &&
+            size == TRAJ_CHUNK_HEADER_SIZE + header->length;
+}
+
+inline void writeTrajAck(quint16 transfer, quint16 index, char *data) {
+    uchar *dst = reinterpret_cast<uchar *>(data);
+    qToBigEndian<quint32>(TRAJ_ACK_MAGIC, dst);
+    qToBigEndian<quint16>(transfer, dst + 4);
+    qToBigEndian<quint16>(index, dst + 6);
+}
+
+inline bool readTrajAck(char const *data, qint64 size,
+                        quint16 *transfer, quint16 *index) {
+    // acks are fixed size, so telemetry is never mistaken for one
+    if (size != TRAJ_ACK_SIZE) return false;
+    uchar const *src = reinterpret_cast<uchar const *>(data);
+    if (qFromBigEndian<quint32>(src) != TRAJ_ACK_MAGIC) return false;
+    *transfer = qFromBigEndian<quint16>(src + 4);
+    *index = qFromBigEndian<quint16>(src + 6);
+    return true;
+}
+
+}  // namespace optgui
+
+#endif  // TRAJ_CHUNK_H_
@@ -0,0 +1,68 @@
+// TITLE:   Optimization_Interface/include/network/traj_uplink.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Chunked trajectory uplink to one vehicle, resends only
+// chunks that have not been acknowledged
+
+#ifndef TRAJ_UPLINK_H_
+#define TRAJ_UPLINK_H_
+
+#include <QObject>
+#include <QUdpSocket>
+#include <QTimer>
+#include <QVector>
+
+#include "include/network/traj_chunk.h"
+
+namespace optgui {
+
+// time to wait for acks before resending
+int const TRAJ_UPLINK_RESEND_MS = 50;
+// max sends of a chunk before giving up on transfer
+quint32 const TRAJ_UPLINK_MAX_ATTEMPTS = 10;
+
+class TrajUplink : public QObject {
+    Q_OBJECT
+
+ public:
+    // sends from socket, child of socket so it follows it
+    // onto the network thread
+    explicit TrajUplink(QUdpSocket *socket);
+
+    // start transfer of serialized traj, replaces any
+    // transfer in progress
+    void send(QByteArray const &datagram, QHostAddress const &address,
+              quint16 port);
+    // mark chunk acknowledged, returns false if datagram is not
+    // an ack for this uplink, acks must come from the address and
+    // port chunks were sent to so vehicles sharing a host are not
+    // confused
+    bool receiveAck(char const *data, qint64 size,
+                    QHostAddress const &address, quint16 port);
+
+ private slots:
+    // resend unacknowledged chunks
+    void resend();
+
+ private:
+    QUdpSocket *socket_;
+    QTimer *resend_timer_;
+
+    // transfer in progress
+    QByteArray datagram_;
+    QHostAddress address_;
+    quint16 port_;
+    quint16 transfer_;
+    quint16 num_chunks_;
+    QVector<bool> acked_;
+    quint16 num_unacked_;
+    quint32 attempts_;
+
+    void writeChunk(quint16 index);
+};
+
+}  // namespace optgui
+
+#endif  // TRAJ_UPLINK_H_
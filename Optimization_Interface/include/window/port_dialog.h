@@ -10,6 +10,8 @@
 
 #include <QDialog>
 #include <QTableWidget>
+#include <QCheckBox>
+#include <QSpinBox>
 
 #include "include/models/constraint_model.h"
 
@@ -26,6 +28,12 @@ class PortDialog : public QDialog {
     void fillTable(ConstraintModel *model);
     // save network configuration to data models on close
     void closeEvent(QCloseEvent *event) override;
+    // receive all telemetry on one port, routed by object port
+    bool isMultiplexed();
+    // listening port used when multiplexed
+    quint16 getMultiplexPort();
+    // send trajectories in acknowledged chunks
+    bool isChunkedUplink();
 
  private slots:
     // clear contents of table
@@ -42,6 +50,13 @@ class PortDialog : public QDialog {
     QTableWidget *port_table_;
     // table for drone listening port and destination address
     QTableWidget *drone_table_;
+    // toggle and port for single multiplexed listening port,
+    // owned by row widget
+    QWidget *multiplex_row_;
+    QCheckBox *multiplex_box_;
+    QSpinBox *multiplex_port_box_;
+    // toggle for chunked trajectory uplink
+    QCheckBox *chunked_box_;
     // currently used ports, shared between all input boxes
     QSet<quint16> *ports_;
 };
@@ -0,0 +1,133 @@
+// TITLE:   Optimization_Interface/recorder_convert/recorder_convert.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Converts a flight data recording into one csv per record type,
+// times are seconds since the start of the recording
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QFile>
+#include <QFileInfo>
+#include <QTextStream>
+
+#include "include/controls/flight_record.h"
+
+using optgui::FlightRecord;
+
+// output table for one record type
+struct RecordTable {
+    QString suffix;
+    QString columns;
+    // number of values written per row
+    quint32 num_values;
+};
+
+RecordTable const RECORD_TABLES[] = {
+    {"", "", 0},
+    {"_telemetry.csv",
+     "time,vehicle,pos_n,pos_e,pos_d,vel_n,vel_e,vel_d,"
+     "accl_n,accl_e,accl_d", 9},
+    {"_solve.csv",
+     "time,vehicle,pos_n,pos_e,pos_d,vel_n,vel_e,vel_d,"
+     "final_time,feasible,latency_ms,horizon", 10},
+    {"_reference.csv",
+     "time,vehicle,pos_n,pos_e,pos_d,vel_n,vel_e,vel_d,"
+     "accl_n,accl_e,accl_d,traj_time,index", 11},
+    {"_drops.csv", "time,vehicle,dropped,producer", 2}
+};
+
+quint32 const NUM_RECORD_TABLES = 5;
+
+int main(int argc, char *argv[]) {
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName(
+                "Optimization_Interface_Recorder_Convert");
+
+    // parse options
+    QCommandLineParser parser;
+    parser.setApplicationDescription(
+            "Convert a flight data recording to csv files");
+    parser.addHelpOption();
+    parser.addPositionalArgument("recording", "Recorded .oifr file.");
+    parser.process(app);
+
+    QTextStream out(stdout);
+    if (parser.positionalArguments().size() != 1) {
+        parser.showHelp(1);
+    }
+
+    // map whole recording read only
+    QString filename = parser.positionalArguments().first();
+    QFile file(filename);
+    if (!file.open(QIODevice::ReadOnly)) {
+        out << "failed to open " << filename << "\n";
+        return 1;
+    }
+    qint64 num_records = file.size() / sizeof(FlightRecord);
+    uchar *mapped = num_records > 0 ? file.map(0, file.size()) : nullptr;
+    if (mapped == nullptr) {
+        out << "failed to map " << filename << "\n";
+        return 1;
+    }
+    FlightRecord const *records =
+            reinterpret_cast<FlightRecord const *>(mapped);
+
+    // check header
+    FlightRecord const &header = records[0];
+    if (header.type != optgui::HEADER_RECORD ||
+            header.vehicle != optgui::FLIGHT_RECORD_MAGIC ||
+            header.values[0] != optgui::FLIGHT_RECORD_VERSION) {
+        out << filename << " is not a flight data recording\n";
+        return 1;
+    }
+
+    // open one csv per record type next to recording
+    QFileInfo info(filename);
+    QString base = info.absolutePath() + "/" + info.completeBaseName();
+    QFile *tables[NUM_RECORD_TABLES] = { nullptr };
+    QTextStream *streams[NUM_RECORD_TABLES] = { nullptr };
+    for (quint32 i = optgui::TELEMETRY_RECORD; i < NUM_RECORD_TABLES; i++) {
+        tables[i] = new QFile(base + RECORD_TABLES[i].suffix);
+        if (!tables[i]->open(QIODevice::WriteOnly | QIODevice::Text)) {
+            out << "failed to create " << tables[i]->fileName() << "\n";
+            return 1;
+        }
+        streams[i] = new QTextStream(tables[i]);
+        streams[i]->setRealNumberPrecision(10);
+        *streams[i] << RECORD_TABLES[i].columns << "\n";
+    }
+
+    // write rows, skipping unknown types from newer versions
+    qint64 counts[NUM_RECORD_TABLES] = { 0 };
+    for (qint64 i = 1; i < num_records; i++) {
+        FlightRecord const &record = records[i];
+        if (record.type == optgui::HEADER_RECORD ||
+                record.type >= NUM_RECORD_TABLES) continue;
+
+        QTextStream &stream = *streams[record.type];
+        stream << (record.stamp_nsecs - header.stamp_nsecs) / 1e9
+               << "," << record.vehicle;
+        for (quint32 j = 0; j < RECORD_TABLES[record.type].num_values;
+                j++) {
+            qreal value = record.values[j];
+            // latency is recorded in nanoseconds
+            if (record.type == optgui::SOLVE_RECORD && j == 8) {
+                value /= 1e6;
+            }
+            stream << "," << value;
+        }
+        stream << "\n";
+        counts[record.type]++;
+    }
+
+    // clean up
+    for (quint32 i = optgui::TELEMETRY_RECORD; i < NUM_RECORD_TABLES; i++) {
+        out << tables[i]->fileName() << ": " << counts[i] << " rows\n";
+        delete streams[i];
+        delete tables[i];
+    }
+    file.unmap(mapped);
+    return 0;
+}
@@ -0,0 +1,24 @@
+#-------------------------------------------------
+#
+# Offline converter of flight data recordings to csv
+#
+#-------------------------------------------------
+
+QT       += core
+QT       -= gui
+
+TARGET = Optimization_Interface_Recorder_Convert
+TEMPLATE = app
+CONFIG += console
+CONFIG -= app_bundle
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+# resolve include/... paths from the gui project
+INCLUDEPATH += $$PWD/..
+
+SOURCES += \
+    recorder_convert.cpp
+
+HEADERS += \
+    ../include/controls/flight_record.h
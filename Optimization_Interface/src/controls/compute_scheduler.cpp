@@ -0,0 +1,148 @@
+// TITLE:   Optimization_Interface/src/controls/compute_scheduler.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/controls/compute_scheduler.h"
+#include "include/controls/compute_worker.h"
+
+#include <QThread>
+
+#include <algorithm>
+
+namespace optgui {
+
+ComputeScheduler::ComputeScheduler(ConstraintModel *model,
+                                   quint32 num_workers)
+    : mutex_(), job_finished_(), jobs_(), busy_jobs_(), last_taken_() {
+    this->model_ = model;
+    this->num_taken_ = 0;
+    this->is_running_ = true;
+
+    // size pool to cores, leaving one for the GUI thread
+    if (num_workers == 0) {
+        num_workers = qMax(1, QThread::idealThreadCount() - 1);
+    }
+
+    // start workers
+    for (quint32 i = 0; i < num_workers; i++) {
+        ComputeWorker *worker = new ComputeWorker(this->model_, this);
+        this->workers_.append(worker);
+        worker->start();
+    }
+}
+
+ComputeScheduler::~ComputeScheduler() {
+    // flag workers to stop
+    {
+        QMutexLocker locker(&this->mutex_);
+        this->is_running_ = false;
+    }
+    // wake sleeping workers and wait for current solves to finish
+    this->model_->wakeComputeThreads();
+    for (ComputeWorker *worker : this->workers_) {
+        worker->wait();
+        delete worker;
+    }
+    this->workers_.clear();
+}
+
+void ComputeScheduler::addJob(ComputeThread *job) {
+    QMutexLocker locker(&this->mutex_);
+    this->jobs_.append(job);
+    this->last_taken_[job] = 0;
+    // wake workers to solve new vehicle
+    this->model_->wakeComputeThreads();
+}
+
+void ComputeScheduler::removeJob(ComputeThread *job) {
+    QMutexLocker locker(&this->mutex_);
+    // flag vehicle to not be solved again
+    job->stopCompute();
+    this->jobs_.removeAll(job);
+    this->last_taken_.remove(job);
+    // wait for solve in progress so caller can delete job
+    while (this->busy_jobs_.contains(job)) {
+        this->job_finished_.wait(&this->mutex_);
+    }
+}
+
+bool ComputeScheduler::isRunning() {
+    QMutexLocker locker(&this->mutex_);
+    return this->is_running_;
+}
+
+quint32 ComputeScheduler::getPriority(ComputeThread *job,
+                                      DroneModelItem *curr_drone,
+                                      DroneModelItem *staged_drone) {
+    // solve vehicle being edited or staged first
+    DroneModelItem *drone = job->getDroneGraphic()->model_;
+    if (drone == curr_drone || drone == staged_drone) {
+        return 0;
+    }
+    return 1;
+}
+
+bool ComputeScheduler::claimJob(ComputeThread *job) {
+    QMutexLocker locker(&this->mutex_);
+    if (!this->is_running_ || !this->jobs_.contains(job) ||
+            this->busy_jobs_.contains(job)) {
+        return false;
+    }
+    this->busy_jobs_.insert(job);
+    return true;
+}
+
+ComputeThread *ComputeScheduler::takeJob() {
+    // get priority vehicles before locking jobs
+    DroneModelItem *curr_drone = this->model_->getCurrDrone();
+    DroneModelItem *staged_drone = this->model_->getStagedDrone();
+
+    // order idle vehicles by priority, least recently
+    // taken first within same priority
+    struct Candidate {
+        ComputeThread *job;
+        quint32 priority;
+        quint64 taken;
+    };
+    QVector<Candidate> candidates;
+    {
+        QMutexLocker locker(&this->mutex_);
+        if (!this->is_running_) return nullptr;
+        candidates.reserve(this->jobs_.size());
+        for (ComputeThread *job : this->jobs_) {
+            if (this->busy_jobs_.contains(job)) continue;
+            candidates.append({job,
+                    this->getPriority(job, curr_drone, staged_drone),
+                    this->last_taken_.value(job)});
+        }
+    }
+    std::sort(candidates.begin(), candidates.end(),
+              [](Candidate const &a, Candidate const &b) {
+        return a.priority < b.priority ||
+                (a.priority == b.priority && a.taken < b.taken);
+    });
+
+    // check inputs of claimed vehicle without holding jobs lock,
+    // claim keeps it from being deleted while checked
+    for (Candidate const &candidate : candidates) {
+        if (!this->claimJob(candidate.job)) continue;
+        if (candidate.job->needsSolve()) {
+            QMutexLocker locker(&this->mutex_);
+            this->num_taken_++;
+            this->last_taken_[candidate.job] = this->num_taken_;
+            return candidate.job;
+        }
+        // release vehicle with nothing to solve
+        this->finishJob(candidate.job);
+    }
+    return nullptr;
+}
+
+void ComputeScheduler::finishJob(ComputeThread *job) {
+    QMutexLocker locker(&this->mutex_);
+    this->busy_jobs_.remove(job);
+    this->job_finished_.wakeAll();
+}
+
+}  // namespace optgui
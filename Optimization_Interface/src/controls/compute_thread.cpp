@@ -7,230 +7,386 @@
 #include "include/graphics/path_graphics_item.h"
 
 #include <algorithm>
+#include <cstring>
+#include <memory>
 #include <QVector3D>
+#include <QElapsedTimer>
 
 namespace optgui {
 
 ComputeThread::ComputeThread(ConstraintModel *model,
                              DroneGraphicsItem *drone,
-                             PathGraphicsItem *traj_graphic) : mutex_() {
+                             PathGraphicsItem *traj_graphic,
+                             FlightRecordWriter *record_writer)
+    : mutex_() {
     this->model_ = model;
-    // start running compute loop on construction
+    // solve vehicle until removed
     this->run_loop_ = true;
     this->drone_ = drone;
     this->traj_graphic_ = traj_graphic;
     this->target_ = nullptr;
     this->target_changed_ = true;
+    // solve on first iteration
+    this->solved_generation_ = 0;
+    this->solved_drone_generation_ = 0;
+    this->refine_solves_ = 0;
+    this->is_converged_ = false;
+    this->expected_solve_nsecs_ = 0;
+    this->record_writer_ = record_writer;
+    this->records_ = nullptr;
+    if (record_writer) {
+        this->records_ = record_writer->createQueue(SOLVER_PRODUCER);
+    }
 }
 
 ComputeThread::~ComputeThread() {
-    QMutexLocker(&this->mutex_);
+    QMutexLocker locker(&this->mutex_);
+    if (this->records_) {
+        this->record_writer_->destroyQueue(this->records_);
+    }
 }
 
 void ComputeThread::stopCompute() {
-    // flag loop to stop after the next iteration
-    QMutexLocker(&this->mutex_);
+    // flag vehicle to not be solved again
+    QMutexLocker locker(&this->mutex_);
     this->run_loop_ = false;
 }
 
 void ComputeThread::setTarget(PointModelItem *target) {
-    QMutexLocker(&this->mutex_);
+    QMutexLocker locker(&this->mutex_);
     if (target != this->target_) {
         this->target_changed_ = true;
     }
     this->target_ = target;
+    // wake workers if sleeping
+    this->model_->wakeComputeThreads();
 }
 
 void ComputeThread::reInit() {
-    QMutexLocker(&this->mutex_);
+    QMutexLocker locker(&this->mutex_);
     this->target_changed_ = true;
+    // wake workers if sleeping
+    this->model_->wakeComputeThreads();
 }
 
 PointModelItem *ComputeThread::getTarget() {
-    QMutexLocker(&this->mutex_);
+    QMutexLocker locker(&this->mutex_);
     return this->target_;
 }
 
 bool ComputeThread::getRunFlag() {
-    QMutexLocker(&this->mutex_);
+    QMutexLocker locker(&this->mutex_);
     return this->run_loop_;
 }
 
 PathGraphicsItem *ComputeThread::getTrajGraphic() {
-    QMutexLocker(&this->mutex_);
+    QMutexLocker locker(&this->mutex_);
     return this->traj_graphic_;
 }
 
 DroneGraphicsItem *ComputeThread::getDroneGraphic() {
-    QMutexLocker(&this->mutex_);
+    QMutexLocker locker(&this->mutex_);
     return this->drone_;
 }
 
-void ComputeThread::run() {
-    // run compute loop until flagged to stop
-    while (this->getRunFlag()) {
-        // Do not compute new trajectories if executing
-        // sent trajectory
-        if (this->model_->isLiveReference()) {
-            continue;
-        }
+bool ComputeThread::needsSolve() {
+    // Do not compute new trajectories if executing
+    // sent trajectory
+    if (this->model_->isLiveReference()) return false;
+
+    QMutexLocker locker(&this->mutex_);
+    // Do not solve removed vehicle
+    if (!this->run_loop_) return false;
+    // Clear trajectory once if no final point selected
+    if (this->target_ == nullptr) return this->target_changed_;
+    // solve if new target, inputs changed since last solve,
+    // or successive solves have not converged
+    return this->target_changed_
+            || !this->is_converged_
+            || this->solved_generation_ != this->model_->getGeneration()
+            || this->solved_drone_generation_ !=
+               this->drone_->model_->getStateGeneration();
+}
 
-        // Do not compute trajectory if no final point selected
-        if (this->getTarget() == nullptr) {
-            // clear current trajectory
-            this->getTrajGraphic()->model_->setPoints(QVector<QPointF>());
-            autogen::packet::traj3dof empty_traj;
-            this->model_->setCurrTraj3dof(this->drone_->model_, empty_traj);
-            continue;
+bool ComputeThread::isConverged(skyenet::outputs const &O, quint32 size) {
+    // compare traj with last solve and save it for next comparison
+    bool is_converged =
+            static_cast<quint32>(this->solved_traj_.size()) == size;
+    this->solved_traj_.resize(size);
+    for (quint32 i = 0; i < size; i++) {
+        QVector3D point(O.r[0][i], O.r[1][i], O.r[2][i]);
+        if (is_converged && (point - this->solved_traj_.at(i)).length() >
+                COMPUTE_CONVERGED_TOL) {
+            is_converged = false;
         }
+        this->solved_traj_[i] = point;
+    }
+    return is_converged;
+}
 
-        // Validate inputs
-        QVector3D initial_pos = this->drone_->model_->getPos();
-        QVector3D initial_vel = this->drone_->model_->getVel();
-        QVector3D initial_acc = this->drone_->model_->getAccel();
-
-        QPointF final_pos_2D = this->getTarget()->getPos();
-        QVector3D final_pos = QVector3D(final_pos_2D.x(), final_pos_2D.y(), 0);
-        QVector<QRegion> ellipse_regions = this->model_->getEllipseRegions();
-
-        // validate inputs
-        INPUT_CODE input_code = this->validateInputs(ellipse_regions,
-                                                     initial_pos, final_pos);
-        // set valid input and update message if changed
-        if (this->model_->setIsValidInput(input_code)) {
-            this->model_->updateEllipseColors();
-            emit updateMessage(this->drone_->model_);
+void ComputeThread::solve() {
+    // Do not compute new trajectories if executing
+    // sent trajectory or vehicle removed
+    if (this->model_->isLiveReference() || !this->getRunFlag()) return;
+
+    // Do not compute trajectory if no final point selected
+    if (this->getTarget() == nullptr) {
+        {
+            QMutexLocker locker(&this->mutex_);
+            this->target_changed_ = false;
         }
-        // Dont compute if invalid input
-//        if (input_code != INPUT_CODE::VALID_INPUT) {
-//            continue;
-//        }
-
-        // Parameters
-
-        // Get params
-        skyenet::params P = this->model_->getSkyeFlyParams();
-        this->model_->loadEllipseConstraints(&P);
-        this->model_->loadPosConstraints(&P);
-
-        double r_i[3] = { 0 };
-        double v_i[3] = { 0 };
-        double a_i[3] = { 0 };
-        double r_f[3] = { 0 };
-        double wp[skyenet::MAX_WAYPOINTS][3] = {{ 0 }};
-
-        // set initial drone pos
-        QVector3D xyz_drone_pos = guiXyzToXyz(initial_pos);
-        r_i[0] = xyz_drone_pos.x();
-        r_i[1] = xyz_drone_pos.y();
-        r_i[2] = xyz_drone_pos.z();
-
-        // set initial drone vel
-        QVector3D xyz_drone_vel = guiXyzToXyz(initial_vel);
-        v_i[0] = xyz_drone_vel.x();
-        v_i[1] = xyz_drone_vel.y();
-        v_i[2] = xyz_drone_vel.z();
-
-        // set iniital drone accel
-        QVector3D xyz_drone_acc = guiXyzToXyz(initial_acc);
-        a_i[0] = xyz_drone_acc.x();
-        a_i[1] = xyz_drone_acc.y();
-        a_i[2] = xyz_drone_acc.z();
-
-        // set final pos
-        QVector3D xyz_final_pos = guiXyzToXyz(final_pos);
-        r_f[0] = xyz_final_pos.x();
-        r_f[1] = xyz_final_pos.y();
-        r_f[2] = xyz_final_pos.z();
-
-        // set waypoints
-        this->model_->loadWaypointConstraints(&P, wp);
-
-        // Initialize problem
-        this->fly_.setParams(P, r_i, v_i, a_i, r_f, wp);
-
-        // check to reset inputs
+        // clear current trajectory
+        this->getTrajGraphic()->model_->setPoints(QVector<QPointF>());
+        emit updateGraphics(this->getTrajGraphic(), this->drone_);
+        autogen::packet::traj3dof empty_traj;
+        this->model_->setCurrTraj3dof(this->drone_->model_, empty_traj);
+        return;
+    }
+
+    // time each phase of the solve
+    QElapsedTimer phase_timer;
+    phase_timer.start();
+
+    // get consistent copy of constraints, changes during solve
+    // are picked up on the next iteration
+    std::shared_ptr<ConstraintSnapshot const> snapshot =
+            this->model_->getSnapshot();
+    this->timing_.record(SNAPSHOT_PHASE, phase_timer.nsecsElapsed());
+    phase_timer.start();
+    quint64 generation = snapshot->generation;
+
+    // get consistent vehicle state from one telemetry sample,
+    // predicted forward to when the traj will be published
+    QElapsedTimer latency_timer;
+    latency_timer.start();
+    DroneState drone_state =
+            this->propagateState(this->drone_->model_->getState());
+    quint64 drone_generation = drone_state.generation;
+
+    // Validate inputs
+    QVector3D initial_pos = drone_state.pos;
+    QVector3D initial_vel = drone_state.vel;
+    QVector3D initial_acc = drone_state.accel;
+
+    QPointF final_pos_2D = this->getTarget()->getPos();
+    QVector3D final_pos = QVector3D(final_pos_2D.x(), final_pos_2D.y(), 0);
+
+    // validate inputs
+    INPUT_CODE input_code = this->validateInputs(snapshot->ellipse_index,
+                                                 initial_pos, final_pos);
+    // set valid input and update message if changed
+    if (this->model_->setIsValidInput(input_code)) {
+        this->model_->updateEllipseColors();
+        emit updateEllipseGraphics();
+        emit updateMessage(this->drone_->model_);
+    }
+    // Dont compute if invalid input
+//    if (input_code != INPUT_CODE::VALID_INPUT) {
+//        return;
+//    }
+
+    // Parameters
+
+    // Get params with constraints loaded
+    skyenet::params P = snapshot->P;
+
+    double r_i[3] = { 0 };
+    double v_i[3] = { 0 };
+    double a_i[3] = { 0 };
+    double r_f[3] = { 0 };
+    double wp[skyenet::MAX_WAYPOINTS][3] = {{ 0 }};
+
+    // set initial drone pos
+    QVector3D xyz_drone_pos = guiXyzToXyz(initial_pos);
+    r_i[0] = xyz_drone_pos.x();
+    r_i[1] = xyz_drone_pos.y();
+    r_i[2] = xyz_drone_pos.z();
+
+    // set initial drone vel
+    QVector3D xyz_drone_vel = guiXyzToXyz(initial_vel);
+    v_i[0] = xyz_drone_vel.x();
+    v_i[1] = xyz_drone_vel.y();
+    v_i[2] = xyz_drone_vel.z();
+
+    // set iniital drone accel
+    QVector3D xyz_drone_acc = guiXyzToXyz(initial_acc);
+    a_i[0] = xyz_drone_acc.x();
+    a_i[1] = xyz_drone_acc.y();
+    a_i[2] = xyz_drone_acc.z();
+
+    // set final pos
+    QVector3D xyz_final_pos = guiXyzToXyz(final_pos);
+    r_f[0] = xyz_final_pos.x();
+    r_f[1] = xyz_final_pos.y();
+    r_f[2] = xyz_final_pos.z();
+
+    // set waypoints
+    std::memcpy(wp, snapshot->wp, sizeof(wp));
+
+    // Initialize problem
+    this->fly_.setParams(P, r_i, v_i, a_i, r_f, wp);
+
+    // check to reset inputs
+    bool is_new_input = generation != this->solved_generation_ ||
+            drone_generation != this->solved_drone_generation_;
+    {
+        QMutexLocker locker(&this->mutex_);
         if (this->target_changed_) {
             this->target_changed_ = false;
+            is_new_input = true;
             this->fly_.resetInputs(r_i, v_i, a_i, r_f, wp);
         }
+    }
 
-        // Run SCvx algorithm for free or fixed final time
-        skyenet::outputs const &O =
-                this->fly_.update(this->model_->isFreeFinalTime());
-
-        // Iterations in resulting trajectory
-        quint32 size = P.K;
-        // GUI trajecotry points
-        QVector<QPointF> trajectory = QVector<QPointF>();
-        // Mikipilot trajectory to send to drone
-        autogen::packet::traj3dof drone_traj3dof_data;
-        drone_traj3dof_data.K = size;
-
-        for (quint32 i = 0; i < size; i++) {
-            // Add points to GUI trajectory
-            QVector3D gui_coords = xyzToGuiXyz(O.r[0][i],
-                                               O.r[1][i],
-                                               O.r[2][i]);
-            trajectory.append(QPointF(gui_coords.x(),
-                                      gui_coords.y()));
-
-            // Add data to mikipilot trajectory
-            // drone_traj3dof_data.clock_angle(k) = 90.0/180.0*3.141592*P.dt*k;
-            drone_traj3dof_data.time(i) = O.t[i];
-
-            // XYZ to NED conversion
-            drone_traj3dof_data.pos_ned(0, i) =  O.r[1][i];
-            drone_traj3dof_data.pos_ned(1, i) =  O.r[0][i];
-            drone_traj3dof_data.pos_ned(2, i) = -O.r[2][i];
-
-            drone_traj3dof_data.vel_ned(0, i) =  O.v[1][i];
-            drone_traj3dof_data.vel_ned(1, i) =  O.v[0][i];
-            drone_traj3dof_data.vel_ned(2, i) = -O.v[2][i];
-
-            drone_traj3dof_data.accl_ned(0, i) =  O.a[1][i];
-            drone_traj3dof_data.accl_ned(1, i) =  O.a[0][i];
-            drone_traj3dof_data.accl_ned(2, i) = -O.a[2][i];
-        }
+    this->timing_.record(PARAM_LOAD_PHASE, phase_timer.nsecsElapsed());
+    phase_timer.start();
 
-        // Do not display new trajectories if executing
-        // sent trajectory. Needed because sometimes compute
-        // overlaps with setting live reference mode
-        if (this->model_->isLiveReference() || !this->getRunFlag()) continue;
-
-        // set points on graphical display
-        this->getTrajGraphic()->model_->setPoints(trajectory);
-        this->model_->setCurrTraj3dof(this->drone_->model_,
-                                      drone_traj3dof_data);
-
-        // OUTPUT VIOLATIONS: initial and final pos violation
-        qreal accum = pow(O.rf_relax[0], 2)  // final pos
-                    + pow(O.rf_relax[1], 2)
-                    + pow(O.rf_relax[2], 2)
-
-                    + pow(O.ri_relax[0], 2)  // initial pos
-                    + pow(O.ri_relax[1], 2)
-                    + pow(O.ri_relax[2], 2)
-
-                    + pow(O.dtau, 2);  // change in time
-
-        bool is_feasible;
-        if (accum > 0.25) {
-            // infeasible traj, set feasibility code and traj color to red
-            this->model_->setIsValidTraj(FEASIBILITY_CODE::INFEASIBLE);
-            is_feasible = false;
-        } else {
-            // feasible traj, set feasibility code and traj color to nominal
-            this->model_->setIsValidTraj(FEASIBILITY_CODE::FEASIBLE);
-            is_feasible = true;
-        }
-        if (this->model_->isFreeFinalTime()) {
-            emit finalTime(this->drone_->model_, O.t[size - 1]);
-        }
-        emit updateMessage(this->drone_->model_);
+    // Run SCvx algorithm for free or fixed final time
+    skyenet::outputs const &O =
+            this->fly_.update(snapshot->is_free_final_time);
+    this->timing_.record(UPDATE_PHASE, phase_timer.nsecsElapsed());
+    phase_timer.start();
+
+    // Iterations in resulting trajectory
+    quint32 size = P.K;
+
+    // keep solving unchanged inputs until traj stops moving
+    if (is_new_input) {
+        this->refine_solves_ = 0;
+    } else {
+        this->refine_solves_++;
+    }
+    this->is_converged_ = this->isConverged(O, size) ||
+            this->refine_solves_ >= COMPUTE_MAX_REFINE_SOLVES;
+    this->solved_generation_ = generation;
+    this->solved_drone_generation_ = drone_generation;
+
+    // GUI trajecotry points, reuses buffer swapped out of
+    // traj model on last solve so no allocation once sized to K
+    QVector<QPointF> &trajectory = this->traj_points_;
+    // buffer is still shared if the traj model was copied before
+    // the last swap, e.g. when staged, so replace it explicitly
+    // instead of copying stale points on the first write
+    if (!trajectory.isDetached()) {
+        trajectory = QVector<QPointF>();
+        trajectory.reserve(size);
+    }
+    trajectory.resize(size);
+    // Mikipilot trajectory to send to drone
+    autogen::packet::traj3dof &drone_traj3dof_data = this->traj3dof_data_;
+    drone_traj3dof_data.K = size;
+
+    for (quint32 i = 0; i < size; i++) {
+        // Add points to GUI trajectory
+        trajectory[i] = xyzToGuiXy(O.r[0][i], O.r[1][i]);
+
+        // Add data to mikipilot trajectory
+        // drone_traj3dof_data.clock_angle(k) = 90.0/180.0*3.141592*P.dt*k;
+        drone_traj3dof_data.time(i) = O.t[i];
+
+        // XYZ to NED conversion
+        drone_traj3dof_data.pos_ned(0, i) =  O.r[1][i];
+        drone_traj3dof_data.pos_ned(1, i) =  O.r[0][i];
+        drone_traj3dof_data.pos_ned(2, i) = -O.r[2][i];
+
+        drone_traj3dof_data.vel_ned(0, i) =  O.v[1][i];
+        drone_traj3dof_data.vel_ned(1, i) =  O.v[0][i];
+        drone_traj3dof_data.vel_ned(2, i) = -O.v[2][i];
+
+        drone_traj3dof_data.accl_ned(0, i) =  O.a[1][i];
+        drone_traj3dof_data.accl_ned(1, i) =  O.a[0][i];
+        drone_traj3dof_data.accl_ned(2, i) = -O.a[2][i];
+    }
+
+    this->timing_.record(CONVERSION_PHASE, phase_timer.nsecsElapsed());
+    phase_timer.start();
+
+    // Do not display new trajectories if executing
+    // sent trajectory. Needed because sometimes compute
+    // overlaps with setting live reference mode
+    if (this->model_->isLiveReference() || !this->getRunFlag()) return;
+
+    // swap points into graphical display, keeping the
+    // previous points as the buffer for the next solve
+    this->getTrajGraphic()->model_->swapPoints(&trajectory);
+    this->model_->setCurrTraj3dof(this->drone_->model_,
+                                  drone_traj3dof_data);
+
+    // OUTPUT VIOLATIONS: initial and final pos violation
+    qreal accum = pow(O.rf_relax[0], 2)  // final pos
+                + pow(O.rf_relax[1], 2)
+                + pow(O.rf_relax[2], 2)
+
+                + pow(O.ri_relax[0], 2)  // initial pos
+                + pow(O.ri_relax[1], 2)
+                + pow(O.ri_relax[2], 2)
 
-        this->setFeasibilityColor(is_feasible);
+                + pow(O.dtau, 2);  // change in time
+
+    bool is_feasible;
+    if (accum > 0.25) {
+        // infeasible traj, set feasibility code and traj color to red
+        this->model_->setIsValidTraj(FEASIBILITY_CODE::INFEASIBLE);
+        is_feasible = false;
+    } else {
+        // feasible traj, set feasibility code and traj color to nominal
+        this->model_->setIsValidTraj(FEASIBILITY_CODE::FEASIBLE);
+        is_feasible = true;
+    }
+    if (snapshot->is_free_final_time) {
+        emit finalTime(this->drone_->model_, O.t[size - 1]);
     }
+    emit updateMessage(this->drone_->model_);
+
+    this->setFeasibilityColor(is_feasible);
+
+    // publish timing of completed solve
+    this->timing_.record(EMIT_PHASE, phase_timer.nsecsElapsed());
+    this->timing_.finishSolve();
+    emit solveTiming(this->drone_->model_);
+
+    // record solve inputs and result
+    if (this->records_) {
+        FlightRecord record = FlightRecorder::makeRecord(SOLVE_RECORD,
+                this->drone_->model_->port_, monotonicNsecs());
+        FlightRecorder::setValues(&record, 0,
+                                  guiXyzToNED(drone_state.pos));
+        FlightRecorder::setValues(&record, 3,
+                                  guiXyzToNED(drone_state.vel));
+        record.values[6] = O.t[size - 1];
+        record.values[7] = is_feasible;
+        record.values[8] = latency_timer.nsecsElapsed();
+        record.values[9] = size;
+        this->records_->push(record);
+    }
+
+    // update expected latency for next propagation
+    this->expected_solve_nsecs_ +=
+            COMPUTE_SOLVE_TIME_WEIGHT *
+            (latency_timer.nsecsElapsed() - this->expected_solve_nsecs_);
+}
+
+DroneState ComputeThread::propagateState(DroneState const &state) {
+    // time from telemetry receipt to expected traj publish
+    qreal dt = ((monotonicNsecs() - state.stamp_nsecs)
+                + this->expected_solve_nsecs_) / 1e9;
+    dt = qBound(0.0, dt, COMPUTE_MAX_PROPAGATION_SEC);
+
+    // telemetry accel includes thrust countering gravity,
+    // remove it to get the vehicle's motion
+    QVector3D accel = state.accel - QVector3D(0, 0, 9.81 * GRID_SIZE);
+
+    // constant acceleration model in pixels
+    DroneState propagated = state;
+    propagated.pos = state.pos + (state.vel * dt) +
+            (accel * (0.5 * dt * dt));
+    propagated.vel = state.vel + (accel * dt);
+    return propagated;
+}
+
+SolveTimingStats ComputeThread::getSolveTiming() {
+    // lock free, safe to call while solving
+    return this->timing_.getStats();
 }
 
 void ComputeThread::setFeasibilityColor(bool is_feasible) {
@@ -250,50 +406,28 @@ void ComputeThread::setFeasibilityColor(bool is_feasible) {
 }
 
 INPUT_CODE ComputeThread::validateInputs(
-        QVector<QRegion> const &ellipse_regions,
+        EllipseIndex const &ellipse_index,
         QVector3D const &initial_pos,
         QVector3D const &final_pos) {
-    // get truncated drone pos
-    QPoint trunc_intial_pos(initial_pos.x(), initial_pos.y());
-    // get truncated final pos
-    QPoint trunc_final_pos(final_pos.x(), final_pos.y());
-
-    // Note: Only can use QPoint. coords are still in pixels so QPoint instead
-    // of QPointF should be fine
-
-    for (int i = 0; i < ellipse_regions.size(); i++) {
-        QRegion const &region = ellipse_regions.at(i);
-
-        // check if contains drone
-        if (region.boundingRect().contains(trunc_intial_pos)) {
-            // check cheaply in rect, then in ellipse
-            if (region.contains(trunc_intial_pos)) {
-                return INPUT_CODE::DRONE_OVERLAP;
-            }
-        }
+    // exact checks against analytic ellipses in pixels,
+    // only ellipses in the same grid cell are tested
 
-        // check if contains final point
-        if (region.boundingRect().contains(trunc_final_pos)) {
-            // check cheaply in rect, then in ellipse
-            if (region.contains(trunc_final_pos)) {
-                return INPUT_CODE::FINAL_POS_OVERLAP;
-            }
-        }
+    // check if contains drone
+    if (ellipse_index.contains(QPointF(initial_pos.x(), initial_pos.y()))) {
+        return INPUT_CODE::DRONE_OVERLAP;
+    }
 
-        // check if overlapping with any other ellipses
-        /* Temp remove for performance
-        for (int j = i+1; j < ellipse_regions.size(); j++) {
-            // First look at intersection of boundingRects (cheaper to do)
-            if (region.boundingRect().intersects(
-                        ellipse_regions.at(j).boundingRect())) {
-                // If bounding rect overlaps, then check fine intersection
-                if (region.intersects(ellipse_regions.at(j))) {
-                    return INPUT_CODE::OBS_OVERLAP;
-                }
-            }
-        }
-        */
+    // check if contains final point
+    if (ellipse_index.contains(QPointF(final_pos.x(), final_pos.y()))) {
+        return INPUT_CODE::FINAL_POS_OVERLAP;
     }
+
+    // check if overlapping with any other ellipses,
+    // checked once when the constraint snapshot is built
+    if (ellipse_index.hasOverlap()) {
+        return INPUT_CODE::OBS_OVERLAP;
+    }
+
     return INPUT_CODE::VALID_INPUT;
 }
 
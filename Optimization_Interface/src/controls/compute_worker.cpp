@@ -0,0 +1,37 @@
+// TITLE:   Optimization_Interface/src/controls/compute_worker.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/controls/compute_worker.h"
+#include "include/controls/compute_scheduler.h"
+#include "include/controls/compute_thread.h"
+
+namespace optgui {
+
+ComputeWorker::ComputeWorker(ConstraintModel *model,
+                             ComputeScheduler *scheduler) {
+    this->model_ = model;
+    this->scheduler_ = scheduler;
+}
+
+void ComputeWorker::run() {
+    // take solves until scheduler is stopped
+    while (this->scheduler_->isRunning()) {
+        // read wakeups before checking jobs so changes made
+        // while checking still wake the worker
+        quint64 wakeups = this->model_->getWakeups();
+
+        // Sleep until inputs change if no vehicle needs a solve
+        ComputeThread *job = this->scheduler_->takeJob();
+        if (job == nullptr) {
+            this->model_->waitForChange(wakeups, COMPUTE_IDLE_TIMEOUT_MS);
+            continue;
+        }
+
+        job->solve();
+        this->scheduler_->finishJob(job);
+    }
+}
+
+}  // namespace optgui
@@ -10,7 +10,6 @@
 #include <QTranslator>
 #include <QSet>
 #include <QDate>
-#include <QTextStream>
 #include <QString>
 
 #include <cmath>
@@ -32,6 +31,7 @@ Controller::Controller(Canvas *canvas) {
     // set canvas and create new model
     this->canvas_ = canvas;
     this->model_ = new ConstraintModel();
+    this->compute_scheduler_ = new ComputeScheduler(this->model_);
 
     // set rendering order
     qreal renderLevel = std::numeric_limits<qreal>::max();
@@ -66,9 +66,15 @@ Controller::Controller(Canvas *canvas) {
     this->port_dialog_ = new PortDialog();
     connect(this->port_dialog_, SIGNAL(setSocketPorts()),
             this, SLOT(startSockets()));
+    this->network_thread_ = new NetworkThread();
+    this->mux_socket_ = nullptr;
+    // sync network graphics once per rendered frame
+    connect(this->canvas_, SIGNAL(syncGraphics()),
+            this, SLOT(refreshNetworkGraphics()));
 
     // Initialize freeze_traj timer
     this->freeze_traj_timer_ = new QTimer();
+    this->freeze_traj_timer_->setTimerType(Qt::PreciseTimer);
     connect(this->freeze_traj_timer_, SIGNAL(timeout()),
             this, SLOT(tickLiveReference()));
     this->is_simulated_ = false;
@@ -78,16 +84,19 @@ Controller::Controller(Canvas *canvas) {
 
     // capture data on by default
     this->capture_data_ = true;
-    this->output_file_ = nullptr;
+    this->record_writer_ = new FlightRecordWriter();
+    this->network_records_ =
+            this->record_writer_->createQueue(NETWORK_PRODUCER);
+    this->reference_records_ =
+            this->record_writer_->createQueue(REFERENCE_PRODUCER);
 }
 
 Controller::~Controller() {
+    // stop workers before deleting the vehicles and
+    // model they solve
+    delete this->compute_scheduler_;
     for (ComputeThread *thread : this->compute_threads_) {
-        thread->stopCompute();
-        // delete should be handled by deletelater slot
-//        thread->quit();
-//        thread->wait();
-//        delete thread;
+        delete thread;
     }
     this->compute_threads_.clear();
 
@@ -96,6 +105,10 @@ Controller::~Controller() {
 
     // deinitialize network
     this->closeSockets();
+    delete this->network_thread_;
+
+    // close recording after all producers are gone
+    delete this->record_writer_;
 
     // clean up model
     delete this->model_;
@@ -141,9 +154,9 @@ void Controller::removeItem(QGraphicsItem *item) {
                 PathGraphicsItem *traj = (*iter)->getTrajGraphic();
                 PathModelItem *traj_model = traj->model_;
 
-                // stop compute
-                (*iter)->stopCompute();
-                // deletion will be handled by deletelater slot
+                // stop compute, waits for solve in progress
+                this->compute_scheduler_->removeJob(*iter);
+                delete *iter;
                 // remove from map
                 iter = this->compute_threads_.erase(iter);
 
@@ -317,6 +330,7 @@ void Controller::addEllipse(QPointF const &point, qreal radius) {
     this->loadEllipse(item_model);
     // update color based on valid input code
     this->model_->updateEllipseColors();
+    this->canvas_->updateEllipseGraphics();
 }
 
 void Controller::addPolygon(QVector<QPointF> points) {
@@ -388,6 +402,7 @@ void Controller::setStagedDrone(DroneModelItem *drone_model) {
             // deselect other staged drones
             drone_graphic->is_staged_drone_ = false;
         }
+        drone_graphic->update();
     }
 }
 
@@ -400,12 +415,13 @@ void Controller::setExecutedDrone(DroneModelItem *drone_model) {
             // deselect other executed drones
             drone_graphic->is_executed_drone_ = false;
         }
+        drone_graphic->update();
     }
 }
 
 void Controller::finalTime(DroneModelItem *drone, qreal time) {
     if (this->model_->isCurrDrone(drone)) {
-        this->setFinaltime(time);
+        this->model_->setSolvedFinaltime(time);
         emit this->finalTime(time);
     }
 }
@@ -416,27 +432,30 @@ void Controller::updateMessage(DroneModelItem *drone) {
     }
 }
 
+void Controller::solveTiming(DroneModelItem *drone) {
+    if (this->model_->isCurrDrone(drone)) {
+        emit this->solveTiming();
+    }
+}
+
 void Controller::freeze_traj() {
-    // compute time difference between each point on traj
-    int msec = (1000 * this->model_->getFinaltime()) /
-            (this->model_->getHorizon() - 1);
-    // start timer to next time interval
-    this->freeze_traj_timer_->start(msec);
+    // play staged traj against monotonic clock, timer only
+    // sets how often the reference is sampled
+    this->reference_player_.start(this->model_->getStagedTraj3dof(),
+                                  monotonicNsecs());
+    this->freeze_traj_timer_->start(REFERENCE_PLAYER_PERIOD_MS);
     if (this->traj_lock_) {
         this->model_->setLiveReferenceMode(true);
     } else {
         this->model_->setLiveReferenceMode(false);
     }
 
-    this->traj_index_ = 0;
-    // update data output with traj
+    // record executed traj
     if (this->capture_data_) {
-        this->createOutputFile();
-        this->updateOutputFile(this->model_->getStagedTraj3dof(),
-                               this->model_->getStagedDrone(),
-                               this->traj_index_);
+        this->startRecording();
     }
-    this->traj_index_++;
+    // sample first knot
+    this->tickLiveReference();
 }
 
 void Controller::setStagedPath() {
@@ -445,8 +464,7 @@ void Controller::setStagedPath() {
     this->setStagedDrone(this->model_->getStagedDrone());
     this->canvas_->path_staged_graphic_->setColor(GREEN);
     // re-render staged traj
-    this->canvas_->path_staged_graphic_->update(
-                this->canvas_->path_staged_graphic_->boundingRect());
+    this->canvas_->path_staged_graphic_->syncGeometry();
 }
 
 void Controller::unsetStagedPath() {
@@ -455,16 +473,18 @@ void Controller::unsetStagedPath() {
     for (DroneGraphicsItem *drone : this->canvas_->drone_graphics_) {
         drone->is_staged_drone_ = false;
         drone->is_executed_drone_ = false;
+        drone->update();
     }
-    this->canvas_->path_staged_graphic_->update(
-                this->canvas_->path_staged_graphic_->boundingRect());
+    this->canvas_->path_staged_graphic_->syncGeometry();
 }
 
 void Controller::tickLiveReference() {
-    // move to next traj point in model
-    if (this->model_->tickPathStaged()) {
-        // more points in tracked traj
-        autogen::packet::traj3dof traj = this->model_->getStagedTraj3dof();
+    // sample traj at true elapsed time, not at tick count
+    ReferenceSample sample;
+    if (this->reference_player_.sample(monotonicNsecs(), &sample)) {
+        // drop passed knots from staged traj
+        this->model_->trimPathStaged(
+                    this->reference_player_.getNumKnots() - sample.index);
 
         // get graphic for current drone
         DroneGraphicsItem *drone = nullptr;
@@ -476,45 +496,32 @@ void Controller::tickLiveReference() {
             }
         }
 
-        int index = this->traj_index_;
-
         // update drone with reference telemetry in simulation mode
         if (this->is_simulated_) {
-            QVector3D coords = nedToGuiXyz(traj.pos_ned(0, index),
-                                           traj.pos_ned(1, index),
-                                           traj.pos_ned(2, index));
-
-            staged_drone->
-                    setVel(nedToGuiXyz(traj.vel_ned(0, index),
-                                       traj.vel_ned(1, index),
-                                       traj.vel_ned(2, index)));
-            staged_drone->
-                    setAccel(nedToGuiXyz(traj.accl_ned(0, index),
-                                         traj.accl_ned(1, index),
-                                         traj.accl_ned(2, index)));
-
-            // set model pos
-            staged_drone->setPos(coords);
+            QVector3D coords = nedToGuiXyz(sample.pos.x(), sample.pos.y(),
+                                           sample.pos.z());
+            staged_drone->setState(coords,
+                                   nedToGuiXyz(sample.vel.x(),
+                                               sample.vel.y(),
+                                               sample.vel.z()),
+                                   nedToGuiXyz(sample.accel.x(),
+                                               sample.accel.y(),
+                                               sample.accel.z()),
+                                   sample.stamp_nsecs);
             // set graphic pos so view knows to draw offscreen
             drone->setPos(QPointF(coords.x(), coords.y()));
         }
 
-        // update output file
-        if (this->capture_data_ && this->output_file_ != nullptr) {
-            this->updateOutputFile(traj, staged_drone, index);
+        // record reference
+        if (this->capture_data_) {
+            this->recordReference(staged_drone, sample);
         }
-
-        this->traj_index_++;
     } else {
-        // close output file
-        if (this->output_file_ != nullptr) {
-            this->output_file_->close();
-            delete this->output_file_;
-            this->output_file_ = nullptr;
-        }
+        // close recording
+        this->record_writer_->close();
 
         // no more points in tracked traj
-        // stop timer between traj time points
+        // stop timer between reference samples
         this->freeze_traj_timer_->stop();
         // flag to stop tracking executed traj
         this->model_->setLiveReferenceMode(false);
@@ -522,8 +529,7 @@ void Controller::tickLiveReference() {
         this->unsetStagedPath();
     }
     // re-render staged traj
-    this->canvas_->path_staged_graphic_->update(
-                this->canvas_->path_staged_graphic_->boundingRect());
+    this->canvas_->path_staged_graphic_->syncGeometry();
 }
 
 
@@ -543,6 +549,7 @@ void Controller::execute() {
             } else {
                 drone->is_executed_drone_ = false;
             }
+            drone->update();
         }
 
         // find traj and set it
@@ -551,10 +558,11 @@ void Controller::execute() {
         if (iter != this->compute_threads_.end()) {
             (*iter)->getTrajGraphic()->model_->
                     setPoints(this->model_->getPathStagedPoints());
+            (*iter)->getTrajGraphic()->syncGeometry();
         }
 
         emit trajectoryExecuted(staged_drone,
-                                this->model_->getStagedTraj3dof());
+                                this->model_->getStagedTrajDatagram());
     } else if (this->freeze_traj_timer_->isActive() &&
                !this->traj_lock_ &&
                this->model_->getIsValidTraj() == FEASIBILITY_CODE::FEASIBLE) {
@@ -564,73 +572,30 @@ void Controller::execute() {
         // this->model_->setPathPoints(this->model_->getPathStagedPoints());
 
         emit trajectoryExecuted(staged_drone,
-                                this->model_->getStagedTraj3dof());
+                                this->model_->getStagedTrajDatagram());
     }
 }
 
-void Controller::createOutputFile() {
-    // close old output file if exists
-    if (this->output_file_ != nullptr) {
-        this->output_file_->close();
-        delete this->output_file_;
-        this->output_file_ = nullptr;
-    }
-
-    // create file in same directory as executable
+void Controller::startRecording() {
+    // create file in same directory as executable,
+    // closes previous recording
     QString filename = QDate::currentDate().toString("'data_'MM_dd_yyyy'");
-    filename.append(QTime::currentTime().toString("'_'hh.mm.ss'.csv'"));
-
-    this->output_file_ = new QFile(filename);
-
-    if (this->output_file_->open(QIODevice::WriteOnly | QIODevice::Text)) {
-        QTextStream stream(this->output_file_);
-
-        stream << "abs_time,rel_time,"
-
-               << "pos_ref_n,pos_ref_e,pos_ref_d,"
-               << "vel_ref_n,vel_ref_e,vel_ref_d,"
-               << "accl_ref_n,accl_ref_e,accl_ref_d,"
-
-               << "pos_telem_n,pos_telem_e,pos_telem_d,"
-               << "vel_telem_n,vel_telem_e,vel_telem_d,"
-               << "accl_telem_n,accl_telem_e,accl_telem_d,"
-
-               << "pos_diff_n,pos_diff_e,pos_diff_d,"
-               << "vel_diff_n,vel_diff_e,vel_diff_d,"
-               << "accl_diff_n,accl_diff_e,accl_diff_d"
-
-               << endl;
-    } else {
-        delete this->output_file_;
-        this->output_file_ = nullptr;
-    }
+    filename.append(QTime::currentTime().toString("'_'hh.mm.ss'.oifr'"));
+    this->record_writer_->open(filename);
 }
 
-void Controller::updateOutputFile(autogen::packet::traj3dof const &traj, DroneModelItem *staged_drone, int index) {
-    QTextStream stream(this->output_file_);
-
-    // time
-    stream << QTime::currentTime().toString("hh.mm.ss") << "," << traj.time(index) << ",";
-
-    // ref
-    stream << traj.pos_ned(0, index) << "," << traj.pos_ned(1, index) << "," << traj.pos_ned(2, index) << ","
-           << traj.vel_ned(0, index) << "," << traj.vel_ned(1, index) << "," << traj.vel_ned(2, index) << ","
-           << traj.accl_ned(0, index) << "," << traj.accl_ned(1, index) << "," << traj.accl_ned(2, index) << ",";
-
-    // telem
-    QVector3D pos_telem_ned(guiXyzToNED(staged_drone->getPos()));
-    QVector3D vel_telem_ned(guiXyzToNED(staged_drone->getVel()));
-    QVector3D accl_telem_ned(guiXyzToNED(staged_drone->getAccel()));
-    stream << pos_telem_ned.x() << "," << pos_telem_ned.y() << "," << pos_telem_ned.z() << ","
-           << vel_telem_ned.x() << "," << vel_telem_ned.y() << "," << vel_telem_ned.z() << ","
-           << accl_telem_ned.x() << "," << accl_telem_ned.y() << "," << accl_telem_ned.z() << ",";
-
-    // diff
-    stream << traj.pos_ned(0, index)-pos_telem_ned.x() << "," << traj.pos_ned(1, index)-pos_telem_ned.y() << "," << traj.pos_ned(2, index)-pos_telem_ned.z() << ","
-           << traj.vel_ned(0, index)-vel_telem_ned.x() << "," << traj.vel_ned(1, index)-vel_telem_ned.y() << "," << traj.vel_ned(2, index)-vel_telem_ned.z() << ","
-           << traj.accl_ned(0, index)-accl_telem_ned.x() << "," << traj.accl_ned(1, index)-accl_telem_ned.y() << "," << traj.accl_ned(2, index)-accl_telem_ned.z();
-
-    stream << endl;
+void Controller::recordReference(DroneModelItem *staged_drone,
+                                 ReferenceSample const &sample) {
+    // reference sent to vehicle, telemetry and solves
+    // are recorded by sockets and compute threads
+    FlightRecord record = FlightRecorder::makeRecord(REFERENCE_RECORD,
+            staged_drone->port_, sample.stamp_nsecs);
+    FlightRecorder::setValues(&record, 0, sample.pos);
+    FlightRecorder::setValues(&record, 3, sample.vel);
+    FlightRecorder::setValues(&record, 6, sample.accel);
+    record.values[9] = sample.time;
+    record.values[10] = sample.index;
+    this->reference_records_->push(record);
 }
 
 void Controller::stageTraj() {
@@ -664,11 +629,9 @@ void Controller::setFreeFinalTime(bool state) {
 }
 
 void Controller::setDataCapture(bool state) {
-    // close current output file when switching modes
-    if (state != this->capture_data_ && this->output_file_ != nullptr) {
-        this->output_file_->close();
-        delete this->output_file_;
-        this->output_file_ = nullptr;
+    // close current recording when switching modes
+    if (state != this->capture_data_) {
+        this->record_writer_->close();
     }
     // set state
     this->capture_data_ = state;
@@ -687,18 +650,35 @@ void Controller::startSockets() {
     // close old sockets
     this->closeSockets();
 
+    // create one socket routing telemetry to all objects
+    if (this->port_dialog_->isMultiplexed()) {
+        this->mux_socket_ = new MuxSocket(
+                    this->canvas_, this->port_dialog_->getMultiplexPort(),
+                    this->port_dialog_->isChunkedUplink(),
+                    this->network_records_);
+        connect(this,
+                SIGNAL(trajectoryExecuted(DroneModelItem *, QByteArray)),
+                this->mux_socket_,
+                SLOT(rx_trajectory(DroneModelItem *, QByteArray)));
+        connect(this->mux_socket_, SIGNAL(refresh_graphics()),
+                this->canvas_, SLOT(requestFrame()));
+        this->network_thread_->addSocket(this->mux_socket_);
+        return;
+    }
+
     // create drone sockets
     for (DroneGraphicsItem *graphic : this->canvas_->drone_graphics_) {
         if (graphic->model_->port_ > 0) {
-            DroneSocket *temp = new DroneSocket(graphic);
+            DroneSocket *temp = new DroneSocket(
+                        graphic, this->port_dialog_->isChunkedUplink(),
+                        this->network_records_);
             connect(this,
-                    SIGNAL(trajectoryExecuted(DroneModelItem *,
-                                             const autogen::packet::traj3dof)),
+                    SIGNAL(trajectoryExecuted(DroneModelItem *, QByteArray)),
                     temp,
-                    SLOT(rx_trajectory(DroneModelItem *,
-                                       const autogen::packet::traj3dof)));
+                    SLOT(rx_trajectory(DroneModelItem *, QByteArray)));
             connect(temp, SIGNAL(refresh_graphics()),
-                    this->canvas_, SLOT(update()));
+                    this->canvas_, SLOT(requestFrame()));
+            this->network_thread_->addSocket(temp);
             this->drone_sockets_.append(temp);
         }
     }
@@ -708,7 +688,8 @@ void Controller::startSockets() {
         if (graphic->model_->port_ > 0) {
             PointSocket *temp = new PointSocket(graphic);
             connect(temp, SIGNAL(refresh_graphics()),
-                    this->canvas_, SLOT(update()));
+                    this->canvas_, SLOT(requestFrame()));
+            this->network_thread_->addSocket(temp);
             this->final_point_sockets_.append(temp);
         }
     }
@@ -718,7 +699,8 @@ void Controller::startSockets() {
         if (graphic->model_->port_ > 0) {
             WaypointSocket *temp = new WaypointSocket(graphic);
             connect(temp, SIGNAL(refresh_graphics()),
-                    this->canvas_, SLOT(update()));
+                    this->canvas_, SLOT(requestFrame()));
+            this->network_thread_->addSocket(temp);
             this->waypoint_sockets_.append(temp);
         }
     }
@@ -728,39 +710,74 @@ void Controller::startSockets() {
         if (graphic->model_->port_ > 0) {
             EllipseSocket *temp = new EllipseSocket(graphic);
             connect(temp, SIGNAL(refresh_graphics()),
-                    this->canvas_, SLOT(update()));
+                    this->canvas_, SLOT(requestFrame()));
+            this->network_thread_->addSocket(temp);
             this->ellipse_sockets_.append(temp);
         }
     }
 }
 
+void Controller::refreshNetworkGraphics() {
+    // set graphics coords from models so view knows whether
+    // to paint them, sockets only write to thread safe models
+    for (DroneSocket *socket : this->drone_sockets_) {
+        QVector3D pos = socket->drone_item_->model_->getPos();
+        socket->drone_item_->setPos(QPointF(pos.x(), pos.y()));
+    }
+    for (PointSocket *socket : this->final_point_sockets_) {
+        socket->point_item_->setPos(socket->point_item_->model_->getPos());
+    }
+    for (WaypointSocket *socket : this->waypoint_sockets_) {
+        socket->waypoint_item_->setPos(
+                    socket->waypoint_item_->model_->getPos());
+    }
+    for (EllipseSocket *socket : this->ellipse_sockets_) {
+        socket->ellipse_item_->setPos(
+                    socket->ellipse_item_->model_->getPos());
+    }
+    if (this->mux_socket_) {
+        this->mux_socket_->syncGraphics();
+    }
+}
+
 void Controller::closeSockets() {
     // close drone sockets
     for (DroneSocket *socket : this->drone_sockets_) {
-        delete socket;
+        this->network_thread_->removeSocket(socket);
     }
     this->drone_sockets_.clear();
 
     // close final point sockets
     for (PointSocket *socket : this->final_point_sockets_) {
-        delete socket;
+        this->network_thread_->removeSocket(socket);
     }
     this->final_point_sockets_.clear();
 
     // close waypoint sockets
     for (WaypointSocket *socket : this->waypoint_sockets_) {
-        delete socket;
+        this->network_thread_->removeSocket(socket);
     }
     this->waypoint_sockets_.clear();
 
     // close ellipse sockets
     for (EllipseSocket *socket : this->ellipse_sockets_) {
-        delete socket;
+        this->network_thread_->removeSocket(socket);
     }
     this->ellipse_sockets_.clear();
+
+    // close multiplexed socket
+    if (this->mux_socket_) {
+        this->network_thread_->removeSocket(this->mux_socket_);
+        this->mux_socket_ = nullptr;
+    }
 }
 
 void Controller::removeEllipseSocket(EllipseModelItem *model) {
+    // stop routing multiplexed telemetry to model
+    if (this->mux_socket_) {
+        this->mux_socket_->removeRoute(model);
+    }
+
     // search for socket for given data model and delete it if
     // it exists
     int index = 0;
@@ -768,7 +785,7 @@ void Controller::removeEllipseSocket(EllipseModelItem *model) {
 
     for (EllipseSocket *socket : this->ellipse_sockets_) {
         if (socket->ellipse_item_->model_ == model) {
-            delete socket;
+            this->network_thread_->removeSocket(socket);
             found = true;
             break;
         }
@@ -781,6 +798,11 @@ void Controller::removeEllipseSocket(EllipseModelItem *model) {
 }
 
 void Controller::removePointSocket(PointModelItem *model) {
+    // stop routing multiplexed telemetry to model
+    if (this->mux_socket_) {
+        this->mux_socket_->removeRoute(model);
+    }
+
     // search for socket for given data model and delete it if
     // it exists
     int index = 0;
@@ -788,7 +810,7 @@ void Controller::removePointSocket(PointModelItem *model) {
 
     for (PointSocket *socket : this->final_point_sockets_) {
         if (socket->point_item_->model_ == model) {
-            delete socket;
+            this->network_thread_->removeSocket(socket);
             found = true;
             break;
         }
@@ -801,12 +823,17 @@ void Controller::removePointSocket(PointModelItem *model) {
 }
 
 void Controller::removeDroneSocket(DroneModelItem *model) {
+    // stop routing multiplexed telemetry to model
+    if (this->mux_socket_) {
+        this->mux_socket_->removeRoute(model);
+    }
+
     int index = 0;
     bool found = false;
 
     for (DroneSocket *socket : this->drone_sockets_) {
         if (socket->drone_item_->model_ == model) {
-            delete socket;
+            this->network_thread_->removeSocket(socket);
             found = true;
             break;
         }
@@ -819,6 +846,11 @@ void Controller::removeDroneSocket(DroneModelItem *model) {
 }
 
 void Controller::removeWaypointSocket(PointModelItem *model) {
+    // stop routing multiplexed telemetry to model
+    if (this->mux_socket_) {
+        this->mux_socket_->removeRoute(model);
+    }
+
     // search for socket for given data model and delete it if
     // it exists
     int index = 0;
@@ -826,7 +858,7 @@ void Controller::removeWaypointSocket(PointModelItem *model) {
 
     for (WaypointSocket *socket : this->waypoint_sockets_) {
         if (socket->waypoint_item_->model_ == model) {
-            delete socket;
+            this->network_thread_->removeSocket(socket);
             found = true;
             break;
         }
@@ -917,9 +949,10 @@ void Controller::loadDrone(DroneModelItem *item_model) {
     this->canvas_->path_graphics_.insert(path_graphic_);
     this->canvas_->addItem(path_graphic_);
 
-    // create compute thread
+    // create compute state, solved by scheduler workers
     ComputeThread *compute_thread_ =
-            new ComputeThread(this->model_, item_graphic, path_graphic_);
+            new ComputeThread(this->model_, item_graphic, path_graphic_,
+                              this->record_writer_);
     this->compute_threads_.insert(item_model, compute_thread_);
     connect(compute_thread_,
             SIGNAL(updateGraphics(PathGraphicsItem *, DroneGraphicsItem *)),
@@ -934,10 +967,14 @@ void Controller::loadDrone(DroneModelItem *item_model) {
             this,
             SLOT(updateMessage(DroneModelItem *)));
     connect(compute_thread_,
-            SIGNAL(finished()),
-            compute_thread_,
-            SLOT(deleteLater()));
-    compute_thread_->start();
+            SIGNAL(solveTiming(DroneModelItem *)),
+            this,
+            SLOT(solveTiming(DroneModelItem *)));
+    connect(compute_thread_,
+            SIGNAL(updateEllipseGraphics()),
+            this->canvas_,
+            SLOT(updateEllipseGraphics()));
+    this->compute_scheduler_->addJob(compute_thread_);
 }
 
 void Controller::loadWaypoint(PointModelItem *item_model) {
@@ -967,6 +1004,8 @@ quint32 Controller::getNumWaypoints() {
 
 void Controller::setClearance(qreal clearance) {
     this->model_->setClearance(clearance);
+    // clearance resizes every ellipse, re-render whole scene
+    this->canvas_->update();
 }
 
 void Controller::setCurrFinalPoint(PointModelItem *point) {
@@ -991,6 +1030,7 @@ void Controller::setCurrDrone(DroneModelItem *drone) {
                 } else {
                     drone_graphic->is_curr_drone_ = false;
                 }
+                drone_graphic->update();
             }
         }
     }
@@ -1004,4 +1044,15 @@ INPUT_CODE Controller::getIsValidInput() {
     return this->model_->getIsValidInput();
 }
 
+SolveTimingStats Controller::getSolveTiming() {
+    // get timing of current drone, empty if none selected
+    QMap<DroneModelItem *, ComputeThread *>::iterator iter =
+            this->compute_threads_.find(this->model_->getCurrDrone());
+    if (iter != this->compute_threads_.end()) {
+        return (*iter)->getSolveTiming();
+    }
+    SolveTimingStats stats = {};
+    return stats;
+}
+
 }  // namespace optgui
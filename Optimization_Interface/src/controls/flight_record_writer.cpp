@@ -0,0 +1,137 @@
+// TITLE:   Optimization_Interface/src/controls/flight_record_writer.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/controls/flight_record_writer.h"
+
+#include "include/globals.h"
+
+namespace optgui {
+
+FlightRecordWriter::FlightRecordWriter(QObject *parent)
+    : QThread(parent), mutex_(), stop_(), is_stopped_(false),
+      request_mutex_(), is_close_requested_(false),
+      is_open_requested_(false), requested_filename_(),
+      queues_(), recorded_drops_(), recorder_() {
+    // write until destroyed
+    this->start();
+}
+
+FlightRecordWriter::~FlightRecordWriter() {
+    {
+        QMutexLocker locker(&this->mutex_);
+        this->is_stopped_ = true;
+        this->stop_.wakeAll();
+    }
+    this->wait();
+
+    // producers must already be gone
+    QMutexLocker locker(&this->mutex_);
+    this->drain();
+    this->recorder_.close();
+    for (FlightRecordQueue *queue : this->queues_) {
+        delete queue;
+    }
+    this->queues_.clear();
+}
+
+void FlightRecordWriter::open(QString const &filename) {
+    {
+        QMutexLocker locker(&this->request_mutex_);
+        this->is_close_requested_ = true;
+        this->is_open_requested_ = true;
+        this->requested_filename_ = filename;
+    }
+    // start recording now instead of after a full period
+    this->stop_.wakeAll();
+}
+
+void FlightRecordWriter::close() {
+    QMutexLocker locker(&this->request_mutex_);
+    // writer drains and closes within one period,
+    // cancels an open not yet applied
+    this->is_close_requested_ = true;
+    this->is_open_requested_ = false;
+}
+
+FlightRecordQueue *FlightRecordWriter::createQueue(
+        FLIGHT_RECORD_PRODUCER producer) {
+    QMutexLocker locker(&this->mutex_);
+    FlightRecordQueue *queue = new FlightRecordQueue(producer);
+    this->queues_.append(queue);
+    this->recorded_drops_.append(0);
+    return queue;
+}
+
+void FlightRecordWriter::destroyQueue(FlightRecordQueue *queue) {
+    QMutexLocker locker(&this->mutex_);
+    qint32 index = this->queues_.indexOf(queue);
+    if (index < 0) return;
+    this->drainQueue(index);
+    this->queues_.remove(index);
+    this->recorded_drops_.remove(index);
+    delete queue;
+}
+
+void FlightRecordWriter::run() {
+    QMutexLocker locker(&this->mutex_);
+    while (!this->is_stopped_) {
+        this->drain();
+        this->applyRequests();
+        // producers never signal, so pushing stays wait free
+        this->stop_.wait(&this->mutex_, FLIGHT_RECORD_WRITER_PERIOD_MS);
+    }
+}
+
+void FlightRecordWriter::drain() {
+    for (qint32 i = 0; i < this->queues_.size(); i++) {
+        this->drainQueue(i);
+    }
+}
+
+void FlightRecordWriter::applyRequests() {
+    // take requests so file I/O runs without request lock
+    bool is_close = false;
+    bool is_open = false;
+    QString filename;
+    {
+        QMutexLocker locker(&this->request_mutex_);
+        is_close = this->is_close_requested_;
+        is_open = this->is_open_requested_;
+        filename = this->requested_filename_;
+        this->is_close_requested_ = false;
+        this->is_open_requested_ = false;
+    }
+
+    if (is_close) {
+        this->recorder_.close();
+    }
+    if (is_open) {
+        this->recorder_.open(filename);
+    }
+}
+
+void FlightRecordWriter::drainQueue(qint32 index) {
+    FlightRecordQueue *queue = this->queues_.at(index);
+
+    // records are dropped by closed recorder between recordings
+    FlightRecord record;
+    while (queue->pop(&record)) {
+        this->recorder_.append(record);
+    }
+
+    // mark gap left by full queue
+    quint64 dropped = queue->getDropped();
+    if (dropped != this->recorded_drops_.at(index)) {
+        FlightRecord drop = FlightRecorder::makeRecord(
+                    DROP_RECORD, queue->getDroppedVehicle(),
+                    monotonicNsecs());
+        drop.values[0] = dropped - this->recorded_drops_.at(index);
+        drop.values[1] = queue->getProducer();
+        this->recorder_.append(drop);
+        this->recorded_drops_[index] = dropped;
+    }
+}
+
+}  // namespace optgui
@@ -0,0 +1,144 @@
+// TITLE:   Optimization_Interface/src/controls/flight_recorder.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/controls/flight_recorder.h"
+
+#include <cstring>
+
+#include "include/globals.h"
+
+namespace optgui {
+
+FlightRecorder::FlightRecorder() : mutex_(), file_(nullptr),
+    segment_(nullptr), segment_index_(0), num_records_(0) {
+}
+
+FlightRecorder::~FlightRecorder() {
+    QMutexLocker locker(&this->mutex_);
+    this->closeFile();
+}
+
+bool FlightRecorder::open(QString const &filename) {
+    QMutexLocker locker(&this->mutex_);
+    this->closeFile();
+
+    this->file_ = new QFile(filename);
+    if (!this->file_->open(QIODevice::ReadWrite | QIODevice::Truncate) ||
+            !this->mapSegment(0)) {
+        delete this->file_;
+        this->file_ = nullptr;
+        this->segment_ = nullptr;
+        return false;
+    }
+
+    // header identifies file format
+    FlightRecord header = FlightRecorder::makeRecord(HEADER_RECORD,
+            FLIGHT_RECORD_MAGIC, monotonicNsecs());
+    header.values[0] = FLIGHT_RECORD_VERSION;
+    this->segment_[0] = header;
+    this->num_records_ = 1;
+    return true;
+}
+
+void FlightRecorder::close() {
+    QMutexLocker locker(&this->mutex_);
+    this->closeFile();
+}
+
+bool FlightRecorder::isOpen() {
+    QMutexLocker locker(&this->mutex_);
+    return this->file_ != nullptr;
+}
+
+void FlightRecorder::append(FlightRecord const &record) {
+    QMutexLocker locker(&this->mutex_);
+    if (this->file_ == nullptr) return;
+
+    // map next segment when current one is full
+    qint64 segment_index = this->num_records_ /
+            FLIGHT_RECORDER_SEGMENT_RECORDS;
+    if (segment_index != this->segment_index_ &&
+            !this->mapSegment(segment_index)) {
+        // disk full, stop recording but keep what was written
+        this->closeFile();
+        return;
+    }
+
+    // copy into mapped file, no allocation or system call
+    this->segment_[this->num_records_ % FLIGHT_RECORDER_SEGMENT_RECORDS] =
+            record;
+    this->num_records_++;
+}
+
+FlightRecord FlightRecorder::makeRecord(FLIGHT_RECORD_TYPE type,
+                                        quint32 vehicle,
+                                        qint64 stamp_nsecs) {
+    FlightRecord record;
+    std::memset(&record, 0, sizeof(record));
+    record.type = type;
+    record.vehicle = vehicle;
+    record.stamp_nsecs = stamp_nsecs;
+    return record;
+}
+
+FlightRecord FlightRecorder::telemetryRecord(quint32 vehicle,
+                                             qint64 stamp_nsecs,
+                                             QVector3D const &pos,
+                                             QVector3D const &vel,
+                                             QVector3D const &accel) {
+    FlightRecord record = FlightRecorder::makeRecord(TELEMETRY_RECORD,
+                                                     vehicle, stamp_nsecs);
+    FlightRecorder::setValues(&record, 0, guiXyzToNED(pos));
+    FlightRecorder::setValues(&record, 3, guiXyzToNED(vel));
+    FlightRecorder::setValues(&record, 6, guiXyzToNED(accel));
+    return record;
+}
+
+void FlightRecorder::setValues(FlightRecord *record, quint32 index,
+                               QVector3D const &vector) {
+    record->values[index] = vector.x();
+    record->values[index + 1] = vector.y();
+    record->values[index + 2] = vector.z();
+}
+
+bool FlightRecorder::mapSegment(qint64 segment_index) {
+    qint64 segment_bytes = FLIGHT_RECORDER_SEGMENT_RECORDS *
+            static_cast<qint64>(sizeof(FlightRecord));
+
+    // release previous segment, its pages are flushed by the OS
+    if (this->segment_ != nullptr) {
+        this->file_->unmap(reinterpret_cast<uchar *>(this->segment_));
+        this->segment_ = nullptr;
+    }
+
+    // grow file to cover segment and map it
+    qint64 offset = segment_index * segment_bytes;
+    if (!this->file_->resize(offset + segment_bytes)) return false;
+    uchar *mapped = this->file_->map(offset, segment_bytes);
+    if (mapped == nullptr) return false;
+
+    this->segment_ = reinterpret_cast<FlightRecord *>(mapped);
+    this->segment_index_ = segment_index;
+    return true;
+}
+
+void FlightRecorder::closeFile() {
+    if (this->file_ == nullptr) return;
+
+    if (this->segment_ != nullptr) {
+        this->file_->unmap(reinterpret_cast<uchar *>(this->segment_));
+        this->segment_ = nullptr;
+    }
+    // drop unused tail of last segment
+    this->file_->resize(this->num_records_ *
+                        static_cast<qint64>(sizeof(FlightRecord)));
+    this->file_->close();
+    delete this->file_;
+    this->file_ = nullptr;
+    this->num_records_ = 0;
+    this->segment_index_ = 0;
+}
+
+}  // namespace optgui
@@ -0,0 +1,89 @@
+// TITLE:   Optimization_Interface/src/controls/reference_player.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/controls/reference_player.h"
+
+namespace optgui {
+
+ReferencePlayer::ReferencePlayer() : traj_(), start_nsecs_(0),
+    index_(0), is_finished_(true) {
+}
+
+void ReferencePlayer::start(autogen::packet::traj3dof const &traj,
+                            qint64 start_nsecs) {
+    this->traj_ = traj;
+    this->start_nsecs_ = start_nsecs;
+    this->index_ = 0;
+    this->is_finished_ = this->traj_.K == 0;
+}
+
+quint32 ReferencePlayer::getNumKnots() {
+    return this->traj_.K;
+}
+
+bool ReferencePlayer::sample(qint64 now_nsecs, ReferenceSample *sample) {
+    if (this->is_finished_) return false;
+
+    // traj time from elapsed time, clamped to final knot
+    quint32 last = this->traj_.K - 1;
+    qreal time = this->traj_.time(0) +
+            ((now_nsecs - this->start_nsecs_) / 1e9);
+    if (time >= this->traj_.time(last)) {
+        time = this->traj_.time(last);
+        this->is_finished_ = true;
+    }
+
+    // advance to segment containing time
+    while (this->index_ < last &&
+           time >= this->traj_.time(this->index_ + 1)) {
+        this->index_++;
+    }
+    quint32 i = this->index_;
+
+    sample->time = time;
+    sample->index = i;
+    sample->stamp_nsecs = now_nsecs;
+    if (i == last) {
+        sample->pos = this->knotPos(i);
+        sample->vel = this->knotVel(i);
+        sample->accel = this->knotAccel(i);
+        return true;
+    }
+
+    // cubic hermite position matches knot velocities,
+    // velocity and accel are linear between knots
+    qreal h = this->traj_.time(i + 1) - this->traj_.time(i);
+    qreal s = (h > 0) ? (time - this->traj_.time(i)) / h : 0;
+    qreal s2 = s * s;
+    qreal s3 = s2 * s;
+    sample->pos = (this->knotPos(i) * ((2 * s3) - (3 * s2) + 1)) +
+            (this->knotVel(i) * (h * (s3 - (2 * s2) + s))) +
+            (this->knotPos(i + 1) * ((3 * s2) - (2 * s3))) +
+            (this->knotVel(i + 1) * (h * (s3 - s2)));
+    sample->vel = (this->knotVel(i) * (1 - s)) + (this->knotVel(i + 1) * s);
+    sample->accel = (this->knotAccel(i) * (1 - s)) +
+            (this->knotAccel(i + 1) * s);
+    return true;
+}
+
+QVector3D ReferencePlayer::knotPos(quint32 index) {
+    return QVector3D(this->traj_.pos_ned(0, index),
+                     this->traj_.pos_ned(1, index),
+                     this->traj_.pos_ned(2, index));
+}
+
+QVector3D ReferencePlayer::knotVel(quint32 index) {
+    return QVector3D(this->traj_.vel_ned(0, index),
+                     this->traj_.vel_ned(1, index),
+                     this->traj_.vel_ned(2, index));
+}
+
+QVector3D ReferencePlayer::knotAccel(quint32 index) {
+    return QVector3D(this->traj_.accl_ned(0, index),
+                     this->traj_.accl_ned(1, index),
+                     this->traj_.accl_ned(2, index));
+}
+
+}  // namespace optgui
@@ -0,0 +1,55 @@
+// TITLE:   Optimization_Interface/src/controls/solve_timing.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/controls/solve_timing.h"
+
+#include <algorithm>
+
+#include "include/globals.h"
+
+namespace optgui {
+
+SolveTiming::SolveTiming() : num_solves_(0) {
+    // samples are zero initialized
+}
+
+void SolveTiming::record(SOLVE_PHASE phase, qint64 nsecs) {
+    // write to slot of current solve
+    quint64 slot = this->num_solves_.loadAcquire() % SOLVE_TIMING_SAMPLES;
+    this->samples_[phase][slot].storeRelease(nsecs);
+}
+
+void SolveTiming::finishSolve() {
+    // publish recorded phases to readers
+    this->num_solves_.fetchAndAddRelease(1);
+}
+
+SolveTimingStats SolveTiming::getStats() {
+    SolveTimingStats stats;
+    stats.num_solves = this->num_solves_.loadAcquire();
+    quint32 size = static_cast<quint32>(
+            std::min<quint64>(stats.num_solves, SOLVE_TIMING_SAMPLES));
+
+    for (quint32 phase = 0; phase < NUM_SOLVE_PHASES; phase++) {
+        stats.p50[phase] = 0;
+        stats.p99[phase] = 0;
+        stats.maximum[phase] = 0;
+        if (size == 0) continue;
+
+        // copy samples, may include phases of a solve in progress
+        qint64 sorted[SOLVE_TIMING_SAMPLES];
+        for (quint32 i = 0; i < size; i++) {
+            sorted[i] = this->samples_[phase][i].loadAcquire();
+        }
+        std::sort(sorted, sorted + size);
+
+        stats.p50[phase] = percentileMsecs(sorted, size, 50);
+        stats.p99[phase] = percentileMsecs(sorted, size, 99);
+        stats.maximum[phase] = percentileMsecs(sorted, size, 100);
+    }
+    return stats;
+}
+
+}  // namespace optgui
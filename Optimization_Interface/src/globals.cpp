@@ -5,6 +5,8 @@
 
 #include "include/globals.h"
 
+#include <chrono>
+
 namespace optgui {
     qreal const GRID_SIZE = 100.0;
     qreal const INIT_CLEARANCE = 0.5;
@@ -62,4 +64,25 @@ namespace optgui {
                          -1.0 * y * GRID_SIZE,
                          z * GRID_SIZE);
     }
+
+    QPointF xyzToGuiXy(qreal x, qreal y) {
+        // QPointF(x, -y)
+        return QPointF(x * GRID_SIZE,
+                       -1.0 * y * GRID_SIZE);
+    }
+
+    qint64 monotonicNsecs() {
+        // steady clock never jumps with wall clock changes
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch())
+                .count();
+    }
+
+    qreal percentileMsecs(qint64 const *sorted, quint32 size,
+                          quint32 percent) {
+        // caller ensures size is not zero, rank is
+        // ceil(percent * size / 100), at least 1
+        quint32 rank = (percent * size + 99) / 100;
+        return sorted[qMax(rank, 1u) - 1] / 1e6;
+    }
 }  // namespace optgui
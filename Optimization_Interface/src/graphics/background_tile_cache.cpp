@@ -0,0 +1,133 @@
+// TITLE:   Optimization_Interface/src/graphics/background_tile_cache.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/graphics/background_tile_cache.h"
+
+#include <QtMath>
+
+#include <cmath>
+
+namespace optgui {
+
+BackgroundTileCache::BackgroundTileCache()
+    : image_levels_(), bbox_(), tiles_(BACKGROUND_TILE_CACHE_KB),
+      background_color_(Qt::black), grid_color_(Qt::gray) {
+}
+
+void BackgroundTileCache::setImage(QImage const &image,
+                                   QRectF const &bbox) {
+    this->image_levels_.clear();
+    if (!image.isNull()) {
+        this->image_levels_.append(
+                    image.convertToFormat(QImage::Format_ARGB32_Premultiplied));
+    }
+    this->bbox_ = bbox;
+    this->tiles_.clear();
+}
+
+void BackgroundTileCache::setStyle(QColor const &background_color,
+                                   QColor const &grid_color) {
+    this->background_color_ = background_color;
+    this->grid_color_ = grid_color;
+    this->tiles_.clear();
+}
+
+void BackgroundTileCache::draw(QPainter *painter, QRectF const &rect,
+                               qreal scale, qint64 segment_size) {
+    // coarsest level whose pixels are no larger than screen pixels
+    qint32 level = qFloor(std::log2(1 / scale));
+    level = qBound(BACKGROUND_MIN_LEVEL, level, BACKGROUND_MAX_LEVEL);
+    qreal span = std::ldexp(static_cast<qreal>(BACKGROUND_TILE_SIZE), level);
+
+    qint64 left = qFloor(rect.left() / span);
+    qint64 right = qFloor(rect.right() / span);
+    qint64 top = qFloor(rect.top() / span);
+    qint64 bottom = qFloor(rect.bottom() / span);
+
+    painter->save();
+    painter->setRenderHint(QPainter::SmoothPixmapTransform);
+    for (qint64 y = top; y <= bottom; y++) {
+        for (qint64 x = left; x <= right; x++) {
+            BackgroundTileKey key = {level, segment_size, x, y};
+            QPixmap *tile = this->tiles_.object(key);
+            if (tile == nullptr) {
+                tile = this->renderTile(key);
+            }
+            painter->drawPixmap(QRectF(x * span, y * span, span, span),
+                                *tile, QRectF(tile->rect()));
+        }
+    }
+    painter->restore();
+}
+
+QPixmap *BackgroundTileCache::renderTile(BackgroundTileKey const &key) {
+    // scene units per tile pixel
+    qreal unit = std::ldexp(1.0, key.level);
+    qreal span = BACKGROUND_TILE_SIZE * unit;
+    QRectF tile_rect(key.x * span, key.y * span, span, span);
+
+    QPixmap *tile = new QPixmap(BACKGROUND_TILE_SIZE, BACKGROUND_TILE_SIZE);
+    tile->fill(this->background_color_);
+    QPainter painter(tile);
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setRenderHint(QPainter::SmoothPixmapTransform);
+    painter.scale(1 / unit, 1 / unit);
+    painter.translate(-tile_rect.topLeft());
+
+    // draw part of image under tile from closest pyramid level
+    QRectF image_rect = tile_rect.intersected(this->bbox_);
+    if (!this->image_levels_.isEmpty() && !image_rect.isEmpty()) {
+        qreal image_unit = this->bbox_.width() /
+                this->image_levels_.first().width();
+        qint32 image_level = qMax(0, qFloor(std::log2(unit / image_unit)));
+        QImage const &image = this->imageLevel(image_level);
+
+        qreal sx = image.width() / this->bbox_.width();
+        qreal sy = image.height() / this->bbox_.height();
+        QRectF source((image_rect.left() - this->bbox_.left()) * sx,
+                      (image_rect.top() - this->bbox_.top()) * sy,
+                      image_rect.width() * sx, image_rect.height() * sy);
+        painter.drawImage(image_rect, image, source);
+    }
+
+    // bake grid lines, 2 pixels wide at this level
+    QPen pen(this->grid_color_);
+    pen.setWidthF(2 * unit);
+    painter.setPen(pen);
+    qint64 seg = key.segment_size;
+    qint64 first_x = qFloor(tile_rect.left() / seg) * seg;
+    qint64 first_y = qFloor(tile_rect.top() / seg) * seg;
+    for (qint64 i = first_x; i <= tile_rect.right() + seg; i += seg) {
+        painter.drawLine(QPointF(i, tile_rect.top() - unit),
+                         QPointF(i, tile_rect.bottom() + unit));
+    }
+    for (qint64 i = first_y; i <= tile_rect.bottom() + seg; i += seg) {
+        painter.drawLine(QPointF(tile_rect.left() - unit, i),
+                         QPointF(tile_rect.right() + unit, i));
+    }
+    painter.end();
+
+    // cost in KiB, cache owns tile
+    BackgroundTileKey cache_key = key;
+    this->tiles_.insert(cache_key, tile,
+            (BACKGROUND_TILE_SIZE * BACKGROUND_TILE_SIZE * 4) / 1024);
+    return tile;
+}
+
+QImage const &BackgroundTileCache::imageLevel(qint32 level) {
+    // halve previous level until requested level exists
+    while (this->image_levels_.size() <= level) {
+        QImage const &prev = this->image_levels_.last();
+        if (prev.width() <= 1 || prev.height() <= 1) {
+            return prev;
+        }
+        this->image_levels_.append(prev.scaled(
+                prev.width() / 2, prev.height() / 2,
+                Qt::IgnoreAspectRatio, Qt::SmoothTransformation));
+    }
+    return this->image_levels_.at(level);
+}
+
+}  // namespace optgui
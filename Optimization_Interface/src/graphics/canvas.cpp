@@ -8,6 +8,9 @@
 #include <QPainter>
 #include <QGraphicsView>
 #include <QGraphicsItem>
+#include <QGuiApplication>
+#include <QScreen>
+#include <QtMath>
 
 #include <cmath>
 #include <limits>
@@ -43,6 +46,21 @@ Canvas::Canvas(QObject *parent, QString background_file)
 
     this->front_depth_ = 0;
     this->setBackgroundImage(background_file);
+
+    // pace repaints to display refresh rate
+    qreal refresh_rate = CANVAS_DEFAULT_REFRESH_RATE;
+    QScreen *screen = QGuiApplication::primaryScreen();
+    if (screen && screen->refreshRate() > 0) {
+        refresh_rate = screen->refreshRate();
+    }
+    this->frame_period_msecs_ = qCeil(1000.0 / refresh_rate);
+    this->frame_timer_ = new QTimer(this);
+    this->frame_timer_->setSingleShot(true);
+    this->frame_timer_->setTimerType(Qt::PreciseTimer);
+    connect(this->frame_timer_, SIGNAL(timeout()),
+            this, SLOT(renderFrame()));
+    this->last_frame_.start();
+    this->ellipses_dirty_ = false;
 }
 
 Canvas::~Canvas() {
@@ -67,7 +85,21 @@ void Canvas::setBackgroundImage(QString filename) {
         this->background_topright_y_ = list[5].toDouble();
     }
 
-    this->background_image_ = QImage(":/assets/" + filename + ".png");
+    // calculate position of background image
+    double width  = this->background_topright_y_
+            - this->background_bottomleft_y_;
+    double height = this->background_topright_x_
+            - this->background_bottomleft_x_;
+
+    QRectF bbox(this->background_bottomleft_y_*GRID_SIZE,
+                -this->background_topright_x_*GRID_SIZE,
+                width*GRID_SIZE,
+                height*GRID_SIZE);
+
+    this->background_tiles_.setStyle(this->backgroundBrush().color(),
+                                     this->background_pen_.color());
+    this->background_tiles_.setImage(
+                QImage(":/assets/" + filename + ".png"), bbox);
 }
 
 void Canvas::bringSelectedToFront() {
@@ -88,13 +120,53 @@ void Canvas::bringSelectedToFront() {
 
 void Canvas::updateGraphicsItems(PathGraphicsItem *traj,
                                  DroneGraphicsItem *drone) {
-    // verify graphics exist
-    if (this->path_graphics_.contains(traj) &&
-        this->drone_graphics_.contains(drone)) {
-        // schedule re-draw
-        traj->update(traj->boundingRect());
-        drone->update(drone->boundingRect());
+    // graphics are verified to exist when frame is rendered
+    this->dirty_paths_.insert(traj);
+    this->dirty_drones_.insert(drone);
+    this->requestFrame();
+}
+
+void Canvas::updateEllipseGraphics() {
+    this->ellipses_dirty_ = true;
+    this->requestFrame();
+}
+
+void Canvas::requestFrame() {
+    // render once a frame period has passed since last frame
+    if (!this->frame_timer_->isActive()) {
+        qint64 wait_msecs = this->frame_period_msecs_ -
+                this->last_frame_.elapsed();
+        this->frame_timer_->start(qMax(wait_msecs, qint64(0)));
+    }
+}
+
+void Canvas::renderFrame() {
+    this->last_frame_.restart();
+
+    // move network graphics to latest telemetry
+    emit syncGraphics();
+
+    // schedule re-draw of changed items that still exist,
+    // view repaints only their bounding rects
+    for (PathGraphicsItem *traj : this->dirty_paths_) {
+        if (this->path_graphics_.contains(traj) ||
+                traj == this->path_staged_graphic_) {
+            traj->syncGeometry();
+        }
+    }
+    for (DroneGraphicsItem *drone : this->dirty_drones_) {
+        if (this->drone_graphics_.contains(drone)) {
+            drone->update();
+        }
+    }
+    if (this->ellipses_dirty_) {
+        for (EllipseGraphicsItem *ellipse : this->ellipse_graphics_) {
+            ellipse->update();
+        }
     }
+    this->dirty_paths_.clear();
+    this->dirty_drones_.clear();
+    this->ellipses_dirty_ = false;
 }
 
 void Canvas::bringToFront(QGraphicsItem *item) {
@@ -109,24 +181,19 @@ void Canvas::bringToFront(QGraphicsItem *item) {
     }
 }
 
-void Canvas::drawForeground(QPainter *painter, const QRectF &rect) {
-    // Get scaling factor for zoom
+void Canvas::drawForeground(QPainter *painter, const QRectF &exposed) {
+    // Get scaling factor for zoom and visible area, exposed
+    // area may be only part of the view
     qreal scale = 1;
+    QRectF rect = exposed;
     if (!this->views().isEmpty()) {
-        scale = this->views().first()->matrix().m11();
+        QGraphicsView *view = this->views().first();
+        scale = view->matrix().m11();
+        rect = view->mapToScene(view->viewport()->rect()).boundingRect();
     }
 
     // get meters scale
-    qint32 segment_size = GRID_SIZE;
-    if (scale < 0.1) {
-        segment_size /= 0.1;
-    } else if (scale < 0.2) {
-        segment_size /= 0.2;
-    } else if (scale < 0.5) {
-        segment_size /= 0.5;
-    } else if (scale > 1.5) {
-        segment_size /= 2;
-    }
+    qint32 segment_size = this->gridSegmentSize(scale);
 
     // scale pens and meter scale
     qreal pen_width = 2 / scale;
@@ -156,20 +223,22 @@ void Canvas::drawForeground(QPainter *painter, const QRectF &rect) {
                       QString::number(qreal(segment_size) / 100) + "m");
 }
 
-qint64 Canvas::roundUpPast(qint64 n, qint64 m) {
-    // return next integer greater than n some multiple of m
-    return ((n + m - 1) / m) * m;
-}
-
-qint64 Canvas::roundDownPast(qint64 n, qint64 m) {
-    // return next integer less than n some multiple of m
-    return ((n - m + 1) / m) * m;
+qint64 Canvas::gridSegmentSize(qreal scale) {
+    // add grids proportional to scaling factor
+    qint64 segment_size = GRID_SIZE;
+    if (scale < 0.1) {
+        segment_size /= 0.1;
+    } else if (scale < 0.2) {
+        segment_size /= 0.2;
+    } else if (scale < 0.5) {
+        segment_size /= 0.5;
+    } else if (scale > 1.5) {
+        segment_size /= 2;
+    }
+    return segment_size;
 }
 
 void Canvas::drawBackground(QPainter *painter, const QRectF &rect) {
-    // Fill background
-    QGraphicsScene::drawBackground(painter, rect);
-
     // Get scaling factor
     qreal scale = 1;
     if (!this->views().isEmpty()) {
@@ -183,64 +252,16 @@ void Canvas::drawBackground(QPainter *painter, const QRectF &rect) {
     //        this->views().first()->setSceneRect(this->sceneRect().united(rect));
     //    }
 
-    // Add grids proportional to scaling factor
-    qint64 segment_size = GRID_SIZE;
-    if (scale < 0.1) {
-        segment_size /= 0.1;
-    } else if (scale < 0.2) {
-        segment_size /= 0.2;
-    } else if (scale < 0.5) {
-        segment_size /= 0.5;
-    } else if (scale > 1.5) {
-        segment_size /= 2;
-    }
+    // blit background image and grid from tiles rendered for
+    // this zoom level, tiles fill the whole exposed area
+    this->background_tiles_.draw(painter, rect, scale,
+                                 this->gridSegmentSize(scale));
 
-    qreal pen_width = 2 / scale;
+    // Draw origin coordinate
     qreal font_size = 20 / scale;
-
-    // Set boundries of grid
-    qint64 top_bound = roundDownPast(qRound64(rect.top()), segment_size);
-    qint64 bot_bound = roundUpPast(qRound64(rect.bottom()), segment_size);
-    qint64 left_bound = roundDownPast(qRound64(rect.left()), segment_size);
-    qint64 right_bound = roundUpPast(qRound64(rect.right()), segment_size);
-
-    // Set pen
-    this->background_pen_.setWidthF(pen_width);
     this->font_.setPointSizeF(font_size);
     painter->setPen(this->background_pen_);
     painter->setFont(this->font_);
-
-    // calculate position of background image
-    double width  = this->background_topright_y_
-            - this->background_bottomleft_y_;
-    double height = this->background_topright_x_
-            - this->background_bottomleft_x_;
-
-    QRectF bbox(this->background_bottomleft_y_*GRID_SIZE,
-                -this->background_topright_x_*GRID_SIZE,
-                width*GRID_SIZE,
-                height*GRID_SIZE);
-
-    // draw background image
-    painter->drawImage(bbox, this->background_image_);
-
-    // Draw vertical grid lines
-    for (qint32 i = 0; i <= right_bound; i += segment_size) {
-        painter->drawLine(i, top_bound, i, bot_bound);
-    }
-    for (qint32 i = 0; i >= left_bound; i -= segment_size) {
-        painter->drawLine(i, top_bound, i , bot_bound);
-    }
-
-    // Draw horizontal grid lines
-    for (qint32 i = 0; i <= bot_bound; i += segment_size) {
-        painter->drawLine(left_bound, i , right_bound, i);
-    }
-    for (qint32 i = 0; i >= top_bound; i -= segment_size) {
-        painter->drawLine(left_bound, i, right_bound, i);
-    }
-
-    // Draw origin coordinate
     painter->drawText(1, -2, "0");
 }
 
@@ -8,6 +8,9 @@
 #include <QGraphicsScene>
 #include <QGraphicsView>
 
+#include "include/graphics/graphics_bounds.h"
+#include "include/graphics/level_of_detail.h"
+
 namespace optgui {
 
 DroneGraphicsItem::DroneGraphicsItem(DroneModelItem *model,
@@ -31,6 +34,7 @@ DroneGraphicsItem::DroneGraphicsItem(DroneModelItem *model,
 
     // set radius
     this->size_ = size;
+    this->diamond_scale_ = 0;
     this->is_curr_drone_ = false;
     this->is_staged_drone_ = false;
     this->is_executed_drone_ = false;
@@ -43,8 +47,11 @@ DroneGraphicsItem::DroneGraphicsItem(DroneModelItem *model,
 }
 
 QRectF DroneGraphicsItem::boundingRect() const {
-    // return area of drawn shape
-    return this->shape().boundingRect();
+    // return area of drawn shape, selection circle, and label
+    qreal size = this->size_ / this->getScalingFactor();
+    return paintedBounds(QRectF(-size, -size, size * 2, size * 2),
+                         this->getScalingFactor(),
+                         this->model_->port_ != 0);
 }
 
 void DroneGraphicsItem::paint(QPainter *painter,
@@ -90,10 +97,15 @@ void DroneGraphicsItem::paint(QPainter *painter,
     painter->setPen(this->pen_);
     painter->setBrush(this->brush_);
 
-    painter->drawPath(this->shape());
+    // rebuild diamond only when zoom changes
+    if (scaling_factor != this->diamond_scale_) {
+        this->diamond_ = this->diamond(scaling_factor);
+        this->diamond_scale_ = scaling_factor;
+    }
+    painter->drawPolygon(this->diamond_);
 
     // Label with port
-    if (this->model_->port_ != 0) {
+    if (this->model_->port_ != 0 && isLabelVisible(scaling_factor)) {
         QPointF text_pos(this->mapFromScene(pos_2D));
         QFont font = painter->font();
         font.setPointSizeF(12.0 / scaling_factor);
@@ -112,17 +124,27 @@ int DroneGraphicsItem::type() const {
 }
 
 QPainterPath DroneGraphicsItem::shape() const {
-    // create diamond shape to draw
+    // get diamond shape, cached if drawn at this zoom
     QPainterPath path;
+    qreal scaling_factor = this->getScalingFactor();
+    if (scaling_factor == this->diamond_scale_) {
+        path.addPolygon(this->diamond_);
+    } else {
+        path.addPolygon(this->diamond(scaling_factor));
+    }
+    return path;
+}
+
+QPolygonF DroneGraphicsItem::diamond(qreal scaling_factor) const {
+    // create diamond shape to draw
     QPolygonF poly;
-    qreal size = this->size_ / this->getScalingFactor();
+    qreal size = this->size_ / scaling_factor;
     poly << QPointF(0, size);
     poly << QPointF(size, 0);
     poly << QPointF(0, -size);
     poly << QPointF(-size, 0);
     poly << QPointF(0, size);
-    path.addPolygon(poly);
-    return path;
+    return poly;
 }
 
 QVariant DroneGraphicsItem::itemChange(GraphicsItemChange change,
@@ -10,6 +10,8 @@
 #include <QGraphicsView>
 
 #include "include/globals.h"
+#include "include/graphics/graphics_bounds.h"
+#include "include/graphics/level_of_detail.h"
 
 namespace optgui {
 
@@ -74,8 +76,11 @@ QRectF EllipseGraphicsItem::boundingRect() const {
         height += ELLIPSE_BORDER / this->getScalingFactor();
         width += ELLIPSE_BORDER / this->getScalingFactor();
     }
-    // return area of ellipse, QGraphicsItems stores rotation
-    return QRectF(-width, -height, width * 2, height * 2);
+    // return area of ellipse, QGraphicsItems stores rotation,
+    // label is drawn unrotated around center
+    return paintedBounds(QRectF(-width, -height, width * 2, height * 2),
+                         this->getScalingFactor(),
+                         this->model_->port_ != 0, QPointF(), M_SQRT2);
 }
 
 void EllipseGraphicsItem::paint(QPainter *painter,
@@ -91,13 +96,17 @@ void EllipseGraphicsItem::paint(QPainter *painter,
     qreal scaling_factor = this->getScalingFactor();
     qreal width = this->model_->getWidth();
     qreal height = this->model_->getHeight();
+    qreal clearance = this->model_->getClearance() * GRID_SIZE;
     QPointF pos = this->model_->getPos();
+    QRectF clearance_rect(-width - clearance, -height - clearance,
+                          (width + clearance) * 2, (height + clearance) * 2);
+    qreal screen_size = screenSize(clearance_rect, scaling_factor);
 
     // update graphics pos with model pos
     this->setPos(pos);
 
-    // Show handles if selected
-    if (this->isSelected()) {
+    // Show handles if selected and large enough to edit
+    if (this->isSelected() && screen_size >= LOD_HANDLE_MIN_PIXELS) {
         this->width_handle_->setPos(-width, 0);
         this->height_handle_->setPos(0, -height);
         this->radius_handle_->setPos(-width * qCos(qDegreesToRadians(45.0)),
@@ -106,33 +115,36 @@ void EllipseGraphicsItem::paint(QPainter *painter,
         this->width_handle_->show();
         this->height_handle_->show();
         this->radius_handle_->show();
-
-        this->pen_.setWidthF(3.0 / scaling_factor);
     } else {
         this->width_handle_->hide();
         this->height_handle_->hide();
         this->radius_handle_->hide();
-
+    }
+    if (this->isSelected()) {
+        this->pen_.setWidthF(3.0 / scaling_factor);
+    } else {
         this->pen_.setWidthF(1.0 / scaling_factor);
     }
-    painter->setPen(this->pen_);
 
-    // Draw shape
-    painter->fillPath(this->shape(), this->brush_);
+    // Draw glyph if too small to see outlines
+    if (screen_size < LOD_GLYPH_PIXELS) {
+        drawGlyph(painter, QPointF(), this->brush_.color(), scaling_factor);
+        return;
+    }
+
+    // Draw filled shape
+    painter->setPen(this->pen_);
+    painter->setBrush(this->brush_);
     painter->drawEllipse(QRectF(-width, -height, width * 2, height * 2));
 
     // Draw clearance boundry
     this->clearance_pen_.setWidthF(3.0 / scaling_factor);
-    qreal clearance_height =
-            height + (this->model_->getClearance() * GRID_SIZE);
-    qreal clearance_width =
-            width + (this->model_->getClearance() * GRID_SIZE);
     painter->setPen(this->clearance_pen_);
-    painter->drawEllipse(QRectF(-clearance_width, -clearance_height,
-                                    clearance_width * 2, clearance_height * 2));
+    painter->setBrush(Qt::NoBrush);
+    painter->drawEllipse(clearance_rect);
 
     // Label with port
-    if (this->model_->port_ != 0) {
+    if (this->model_->port_ != 0 && isLabelVisible(scaling_factor)) {
         painter->rotate(-this->rotation());
         painter->setPen(Qt::black);
         QPointF text_pos(this->mapFromScene(pos));
@@ -178,6 +190,7 @@ void EllipseGraphicsItem::setRed(bool isOverlap) {
 void EllipseGraphicsItem::flipDirection() {
     // flip direction of keep out zone and re-render
     // not currently supported by socp
+    this->prepareGeometryChange();
     this->model_->flipDirection();
     this->update(this->boundingRect());
 }
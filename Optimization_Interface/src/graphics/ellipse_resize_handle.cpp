@@ -53,6 +53,7 @@ void EllipseResizeHandle::mouseMoveEvent(QGraphicsSceneMouseEvent *event) {
         // get rotation of mouse
         QLineF vector(event->scenePos(),
                       parentItem()->scenePos());
+        QRectF old_rect = this->parentItem()->sceneBoundingRect();
 
         qreal rotation = 360 - vector.angle();
         if (this->type_ == 0) {
@@ -80,8 +81,9 @@ void EllipseResizeHandle::mouseMoveEvent(QGraphicsSceneMouseEvent *event) {
         this->model_->setRot(rotation);
         this->parentItem()->setRotation(rotation);
 
-        // re-render ellipse graphic
-        this->update(this->boundingRect());
+        // re-render area covered by old and new ellipse graphic
+        this->scene()->update(old_rect.united(
+                this->parentItem()->sceneBoundingRect()));
     }
 }
 
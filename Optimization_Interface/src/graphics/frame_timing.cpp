@@ -0,0 +1,45 @@
+// TITLE:   Optimization_Interface/src/graphics/frame_timing.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/graphics/frame_timing.h"
+
+#include <algorithm>
+
+#include "include/globals.h"
+
+namespace optgui {
+
+FrameTiming::FrameTiming() : samples_(), num_frames_(0) {
+    // samples are zero initialized
+}
+
+void FrameTiming::record(qint64 nsecs) {
+    // overwrite oldest frame
+    this->samples_[this->num_frames_ % FRAME_TIMING_SAMPLES] = nsecs;
+    this->num_frames_++;
+}
+
+FrameTimingStats FrameTiming::getStats() const {
+    FrameTimingStats stats;
+    stats.num_frames = this->num_frames_;
+    stats.p50 = 0;
+    stats.p99 = 0;
+    stats.maximum = 0;
+    quint32 size = static_cast<quint32>(
+            std::min<quint64>(stats.num_frames, FRAME_TIMING_SAMPLES));
+    if (size == 0) return stats;
+
+    // copy samples to sort
+    qint64 sorted[FRAME_TIMING_SAMPLES];
+    std::copy(this->samples_, this->samples_ + size, sorted);
+    std::sort(sorted, sorted + size);
+
+    stats.p50 = percentileMsecs(sorted, size, 50);
+    stats.p99 = percentileMsecs(sorted, size, 99);
+    stats.maximum = percentileMsecs(sorted, size, 100);
+    return stats;
+}
+
+}  // namespace optgui
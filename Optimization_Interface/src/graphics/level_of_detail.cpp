@@ -0,0 +1,69 @@
+// TITLE:   Optimization_Interface/src/graphics/level_of_detail.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/graphics/level_of_detail.h"
+
+#include <QPair>
+#include <QVector>
+
+namespace optgui {
+
+QPolygonF decimatePolyline(QPolygonF const &points, qreal tolerance) {
+    qint32 size = points.size();
+    if (size < 3) {
+        return points;
+    }
+
+    // flag kept points, end points are always kept
+    QVector<bool> keep(size, false);
+    keep[0] = true;
+    keep[size - 1] = true;
+
+    // split ranges at farthest point until all points are within
+    // tolerance, iterative so long trajectories cannot overflow stack
+    qreal tolerance_2 = tolerance * tolerance;
+    QVector<QPair<qint32, qint32>> ranges;
+    ranges.append(qMakePair(0, size - 1));
+    while (!ranges.isEmpty()) {
+        QPair<qint32, qint32> range = ranges.takeLast();
+        QPointF const &start = points.at(range.first);
+        QPointF segment = points.at(range.second) - start;
+        qreal length_2 = QPointF::dotProduct(segment, segment);
+
+        // find point farthest from segment
+        qreal max_dist_2 = 0;
+        qint32 max_index = -1;
+        for (qint32 i = range.first + 1; i < range.second; i++) {
+            QPointF offset = points.at(i) - start;
+            if (length_2 > 0) {
+                qreal t = QPointF::dotProduct(offset, segment) / length_2;
+                offset -= qBound(0.0, t, 1.0) * segment;
+            }
+            qreal dist_2 = QPointF::dotProduct(offset, offset);
+            if (dist_2 > max_dist_2) {
+                max_dist_2 = dist_2;
+                max_index = i;
+            }
+        }
+
+        if (max_dist_2 > tolerance_2) {
+            keep[max_index] = true;
+            ranges.append(qMakePair(range.first, max_index));
+            ranges.append(qMakePair(max_index, range.second));
+        }
+    }
+
+    // copy kept points in order
+    QPolygonF decimated;
+    decimated.reserve(size);
+    for (qint32 i = 0; i < size; i++) {
+        if (keep.at(i)) {
+            decimated.append(points.at(i));
+        }
+    }
+    return decimated;
+}
+
+}  // namespace optgui
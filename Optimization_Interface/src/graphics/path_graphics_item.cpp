@@ -8,6 +8,8 @@
 #include <QGraphicsScene>
 #include <QGraphicsView>
 
+#include "include/graphics/level_of_detail.h"
+
 namespace optgui {
 
 PathGraphicsItem::PathGraphicsItem(PathModelItem *model,
@@ -24,6 +26,9 @@ PathGraphicsItem::PathGraphicsItem(PathModelItem *model,
 
     // Set flags
     this->setFlags(QGraphicsItem::ItemSendsScenePositionChanges);
+
+    // cache initial points
+    this->snapshotPoints();
 }
 
 void PathGraphicsItem::setColor(QColor color) {
@@ -31,9 +36,26 @@ void PathGraphicsItem::setColor(QColor color) {
     this->pen_.setColor(color);
 }
 
+void PathGraphicsItem::syncGeometry() {
+    // bounds follow model points, repaint old area too
+    this->prepareGeometryChange();
+    this->snapshotPoints();
+    this->update();
+}
+
+void PathGraphicsItem::snapshotPoints() {
+    // copy points with one model lock and map them together
+    this->points_ = this->mapFromScene(QPolygonF(this->model_->getPoints()));
+    this->bounds_ = this->points_.boundingRect();
+    // decimate again on next paint
+    this->lod_scale_ = 0;
+}
+
 QRectF PathGraphicsItem::boundingRect() const {
-    // return rough area of traj line
-    return this->shape().boundingRect();
+    // return rough area of traj line, including pen
+    qreal pen_width = this->width_ / this->getScalingFactor();
+    return this->bounds_.adjusted(-pen_width, -pen_width,
+                                  pen_width, pen_width);
 }
 
 void PathGraphicsItem::paint(QPainter *painter,
@@ -47,31 +69,29 @@ void PathGraphicsItem::paint(QPainter *painter,
     qreal scaling_factor = this->getScalingFactor();
     this->pen_.setWidthF(this->width_ / scaling_factor);
     painter->setPen(this->pen_);
-    quint32 size = this->model_->getSize();
-    for (quint32 i = 1; i < size; i++) {
-        QLineF line(mapFromScene(this->model_->getPointAt(i - 1)),
-                    mapFromScene(this->model_->getPointAt(i)));
-        painter->drawLine(line);
+
+    // drop knots closer to the line than a fraction of a pixel,
+    // redone only when zoom or points change
+    if (scaling_factor != this->lod_scale_) {
+        this->lod_points_ = decimatePolyline(
+                    this->points_, LOD_PATH_TOLERANCE_PIXELS / scaling_factor);
+        this->lod_scale_ = scaling_factor;
     }
+    painter->drawPolyline(this->lod_points_);
 }
 
 QPainterPath PathGraphicsItem::shape() const {
     // return shape of traj line
     QPainterPath path;
-    QPolygonF poly;
-    quint32 size = this->model_->getSize();
-    for (quint32 i = 0; i < size; i++) {
-        poly << this->model_->getPointAt(i);
-    }
-    path.addPolygon(poly);
+    path.addPolygon(this->points_);
     return path;
 }
 
 QVariant PathGraphicsItem::itemChange(GraphicsItemChange change,
                                         const QVariant &value) {
     if (change == ItemScenePositionHasChanged && scene()) {
-        // check redraw
-        this->update(this->boundingRect());
+        // points are cached in item coords, re-map and redraw
+        this->syncGeometry();
     }
     return QGraphicsItem::itemChange(change, value);
 }
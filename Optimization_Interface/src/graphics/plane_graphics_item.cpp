@@ -10,6 +10,8 @@
 #include <QLineF>
 
 #include "include/globals.h"
+#include "include/graphics/graphics_bounds.h"
+#include "include/graphics/level_of_detail.h"
 
 namespace optgui {
 
@@ -50,7 +52,11 @@ PlaneGraphicsItem::~PlaneGraphicsItem() {
 }
 
 QRectF PlaneGraphicsItem::boundingRect() const {
-    return this->shape().boundingRect();
+    // get rough area of plane, line, and label
+    return paintedBounds(this->shape().boundingRect(),
+                         this->getScalingFactor(),
+                         this->model_->port_ != 0,
+                         this->mapFromScene(this->model_->getP1()));
 }
 
 void PlaneGraphicsItem::paint(QPainter *painter,
@@ -63,18 +69,23 @@ void PlaneGraphicsItem::paint(QPainter *painter,
     // scale with view
     qreal scaling_factor = this->getScalingFactor();
 
-    // Show handles if selected
-    if (this->isSelected()) {
+    QLineF line(mapFromScene(this->model_->getP1()),
+                mapFromScene(this->model_->getP2()));
+
+    // Show handles if selected and long enough to edit
+    if (this->isSelected() &&
+            line.length() * scaling_factor >= LOD_HANDLE_MIN_PIXELS) {
         this->p1_handle_->updatePos();
         this->p2_handle_->updatePos();
         this->p1_handle_->show();
         this->p2_handle_->show();
-
-        this->pen_.setWidthF(3.0 / scaling_factor);
     } else {
         this->p1_handle_->hide();
         this->p2_handle_->hide();
-
+    }
+    if (this->isSelected()) {
+        this->pen_.setWidthF(3.0 / scaling_factor);
+    } else {
         this->pen_.setWidthF(1.0 / scaling_factor);
     }
 
@@ -82,12 +93,10 @@ void PlaneGraphicsItem::paint(QPainter *painter,
     painter->setPen(this->pen_);
     painter->setBrush(this->brush_);
     painter->fillPath(this->shape(), this->brush_);
-    QLineF line(mapFromScene(this->model_->getP1()),
-                mapFromScene(this->model_->getP2()));
     painter->drawLine(line);
 
     // Label with port
-    if (this->model_->port_ != 0) {
+    if (this->model_->port_ != 0 && isLabelVisible(scaling_factor)) {
         QPointF text_pos(this->mapFromScene(this->model_->getP1()));
         QFont font = painter->font();
         font.setPointSizeF(12 / scaling_factor);
@@ -130,6 +139,7 @@ QPainterPath PlaneGraphicsItem::shape() const {
 }
 
 void PlaneGraphicsItem::flipDirection() {
+    this->prepareGeometryChange();
     this->model_->flipDirection();
     this->update(this->boundingRect());
 }
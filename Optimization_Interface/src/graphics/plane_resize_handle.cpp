@@ -85,12 +85,15 @@ void PlaneResizeHandle::mouseReleaseEvent(QGraphicsSceneMouseEvent *event) {
 void PlaneResizeHandle::mouseMoveEvent(QGraphicsSceneMouseEvent *event) {
     if (this->resize_) {
         QPointF eventPos = event->scenePos();
+        QRectF old_rect = this->parentItem()->sceneBoundingRect();
         if (this->isP2_) {
             this->model_->setP2(eventPos);
         } else {
             this->model_->setP1(eventPos);
         }
-        this->update(this->boundingRect());
+        // re-render area covered by old and new plane graphic
+        this->scene()->update(old_rect.united(
+                this->parentItem()->sceneBoundingRect()));
     }
 }
 
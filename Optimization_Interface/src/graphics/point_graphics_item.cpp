@@ -10,6 +10,8 @@
 #include <QGraphicsView>
 
 #include "include/globals.h"
+#include "include/graphics/graphics_bounds.h"
+#include "include/graphics/level_of_detail.h"
 
 namespace optgui {
 
@@ -39,10 +41,11 @@ PointGraphicsItem::PointGraphicsItem(PointModelItem *model,
 }
 
 QRectF PointGraphicsItem::boundingRect() const {
-    // return area of point scaled by zoom factor
+    // return area of point and label scaled by zoom factor
     qreal scaling_factor = this->getScalingFactor();
     qreal rad = this->radius_ / scaling_factor;
-    return QRectF(-rad, -rad, rad * 2, rad * 2);
+    return paintedBounds(QRectF(-rad, -rad, rad * 2, rad * 2),
+                         scaling_factor, this->model_->port_ != 0);
 }
 
 void PointGraphicsItem::paint(QPainter *painter,
@@ -72,7 +75,7 @@ void PointGraphicsItem::paint(QPainter *painter,
     painter->drawEllipse(QRectF(-rad, -rad, rad * 2, rad * 2));
 
     // Label with port
-    if (this->model_->port_ != 0) {
+    if (this->model_->port_ != 0 && isLabelVisible(scaling_factor)) {
         painter->setPen(BLACK);
         QPointF text_pos(this->mapFromScene(this->model_->getPos()));
         QFont font = painter->font();
@@ -95,7 +98,8 @@ int PointGraphicsItem::type() const {
 QPainterPath PointGraphicsItem::shape() const {
     // return shape of point
     QPainterPath path;
-    path.addEllipse(this->boundingRect());
+    qreal rad = this->radius_ / this->getScalingFactor();
+    path.addEllipse(QRectF(-rad, -rad, rad * 2, rad * 2));
     return path;
 }
 
@@ -10,6 +10,8 @@
 #include <QLineF>
 
 #include "include/globals.h"
+#include "include/graphics/graphics_bounds.h"
+#include "include/graphics/level_of_detail.h"
 
 namespace optgui {
 
@@ -50,8 +52,11 @@ PolygonGraphicsItem::~PolygonGraphicsItem() {
 }
 
 QRectF PolygonGraphicsItem::boundingRect() const {
-    // get rough area of polygon
-    return this->shape().boundingRect();
+    // get rough area of polygon, outline, and label
+    return paintedBounds(this->shape().boundingRect(),
+                         this->getScalingFactor(),
+                         this->model_->port_ != 0,
+                         this->mapFromScene(this->model_->getPointAt(0)));
 }
 
 void PolygonGraphicsItem::paint(QPainter *painter,
@@ -79,28 +84,39 @@ void PolygonGraphicsItem::paint(QPainter *painter,
         scaling_factor = this->scene()->views().first()->matrix().m11();
     }
 
-    // Show handles if selected
-    if (this->isSelected()) {
+    QPainterPath shading = this->shape();
+    QRectF bounds = shading.boundingRect();
+    qreal screen_size = screenSize(bounds, scaling_factor);
+
+    // Show handles if selected and large enough to edit
+    if (this->isSelected() && screen_size >= LOD_HANDLE_MIN_PIXELS) {
         for (PolygonResizeHandle *handle : this->resize_handles_) {
             handle->updatePos();
             handle->show();
         }
-
-        this->pen_.setWidthF(3.0 / scaling_factor);
     } else {
         for (PolygonResizeHandle *handle : this->resize_handles_) {
             handle->hide();
         }
-
+    }
+    if (this->isSelected()) {
+        this->pen_.setWidthF(3.0 / scaling_factor);
+    } else {
         this->pen_.setWidthF(1.0 / scaling_factor);
     }
 
+    // Draw glyph if too small to see outline
+    if (screen_size < LOD_GLYPH_PIXELS) {
+        drawGlyph(painter, bounds.center(), fill, scaling_factor);
+        return;
+    }
+
     painter->setPen(this->pen_);
     painter->setBrush(this->brush_);
 
 
     // Fill shading
-    painter->fillPath(this->shape(), this->brush_);
+    painter->fillPath(shading, this->brush_);
 
     // Draw outline
     quint32 size = this->model_->getSize();
@@ -111,7 +127,7 @@ void PolygonGraphicsItem::paint(QPainter *painter,
     }
 
     // Label with port
-    if (this->model_->port_ != 0) {
+    if (this->model_->port_ != 0 && isLabelVisible(scaling_factor)) {
         QPointF text_pos(this->mapFromScene(this->model_->getPointAt(0)));
         QFont font = painter->font();
         font.setPointSizeF(12 / scaling_factor);
@@ -160,6 +176,7 @@ QPainterPath PolygonGraphicsItem::shape() const {
 
 void PolygonGraphicsItem::flipDirection() {
     // flip direction of keep out zone and re-render
+    this->prepareGeometryChange();
     this->model_->flipDirection();
     this->update(this->boundingRect());
 }
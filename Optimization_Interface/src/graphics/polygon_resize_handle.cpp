@@ -75,9 +75,12 @@ void PolygonResizeHandle::mouseReleaseEvent(QGraphicsSceneMouseEvent *event) {
 void PolygonResizeHandle::mouseMoveEvent(QGraphicsSceneMouseEvent *event) {
     if (this->resize_) {
         // update model with handle position and re-render
+        // area covered by old and new polygon graphic
         QPointF eventPos = event->scenePos();
+        QRectF old_rect = this->parentItem()->sceneBoundingRect();
         this->model_->setPointAt(eventPos, this->index_);
-        this->update(this->boundingRect());
+        this->scene()->update(old_rect.united(
+                this->parentItem()->sceneBoundingRect()));
     }
 }
 
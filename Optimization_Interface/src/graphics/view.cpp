@@ -13,6 +13,10 @@
 #include <QPushButton>
 #include <QCheckBox>
 #include <QMessageBox>
+#include <QElapsedTimer>
+#include <QOpenGLWidget>
+#include <QSurfaceFormat>
+#include <QSignalBlocker>
 
 #include "include/controls/compute_thread.h"
 
@@ -69,8 +73,8 @@ View::View(QWidget * parent)
     this->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
     this->setResizeAnchor(QGraphicsView::AnchorViewCenter);
 
-    // Set rendering preference
-    this->setViewportUpdateMode(QGraphicsView::FullViewportUpdate);
+    // Set rendering preference, repaint only changed items
+    this->setViewportUpdateMode(QGraphicsView::MinimalViewportUpdate);
 
     // Set render hint
     this->setRenderHint(QPainter::Antialiasing);
@@ -93,6 +97,7 @@ View::~View() {
     this->skyefly_params_table_->clear();
     delete this->skyefly_params_table_;
     delete this->model_params_table_;
+    delete this->solve_timing_table_;
 
     // Delete layout components
     delete this->menu_button_;
@@ -106,6 +111,20 @@ View::~View() {
     delete this->canvas_;
 }
 
+void View::paintEvent(QPaintEvent *event) {
+    // time render of exposed area
+    QElapsedTimer timer;
+    timer.start();
+    QGraphicsView::paintEvent(event);
+    this->frame_timing_.record(timer.nsecsElapsed());
+}
+
+void View::scrollContentsBy(int dx, int dy) {
+    QGraphicsView::scrollContentsBy(dx, dy);
+    // scale bar is fixed to view, scrolled pixels are stale
+    this->viewport()->update();
+}
+
 bool View::viewportEvent(QEvent *event) {
     // enable pinch zoom/3 finger zoom
     if (event->type() == QEvent::Gesture) {
@@ -200,7 +219,9 @@ void View::initializeExpertPanel() {
     this->initializeSkyeFlyParamsTable(this->expert_panel_);
     this->expert_panel_->menu_layout_->insertStretch(-1, 1);
     this->initializeDataCaptureToggle(this->expert_panel_);
+    this->initializeOpenGLToggle(this->expert_panel_);
     this->initializeModelParamsTable(this->expert_panel_);
+    this->initializeSolveTimingTable(this->expert_panel_);
 
     // Connect menu open/close
     connect(this->expert_menu_button_, SIGNAL(clicked()),
@@ -442,6 +463,13 @@ void View::setFinaltime(qreal final_time) {
     this->controller_->setFinaltime(final_time);
 }
 
+void View::showSolvedFinaltime(qreal final_time) {
+    // display only, rounded value must not be fed back as
+    // a manual change to the model
+    QSignalBlocker blocker(this->finaltime_box_);
+    this->finaltime_box_->setValue(final_time);
+}
+
 void View::setClearance(qreal clearance) {
     this->controller_->setClearance(clearance);
 }
@@ -1196,6 +1224,24 @@ void View::toggleDataCapture(int state) {
     this->controller_->setDataCapture(state == Qt::Checked);
 }
 
+void View::toggleOpenGL(int state) {
+    // view deletes old viewport when replaced
+    if (state == Qt::Checked) {
+        QOpenGLWidget *gl_viewport = new QOpenGLWidget();
+        QSurfaceFormat format = gl_viewport->format();
+        format.setSamples(VIEW_OPENGL_SAMPLES);
+        gl_viewport->setFormat(format);
+        // keep framebuffer between frames so only dirty
+        // bounding rects are repainted
+        gl_viewport->setUpdateBehavior(QOpenGLWidget::PartialUpdate);
+        this->setViewport(gl_viewport);
+    } else {
+        this->setViewport(new QWidget());
+    }
+    // gestures are grabbed per viewport
+    this->viewport()->grabGesture(Qt::PinchGesture);
+}
+
 void View::initializeModelParamsTable(MenuPanel *panel) {
     // Create table
     this->model_params_table_ = new QTableWidget(panel->menu_);
@@ -1235,6 +1281,54 @@ void View::initializeModelParamsTable(MenuPanel *panel) {
     row_index++;
 }
 
+void View::initializeSolveTimingTable(MenuPanel *panel) {
+    // Create table
+    this->solve_timing_table_ = new QTableWidget(panel->menu_);
+    this->solve_timing_table_->setColumnCount(3);  // p50, p99, max
+    // solve phases and view frame
+    this->solve_timing_table_->setRowCount(NUM_SOLVE_PHASES + 1);
+    this->solve_timing_table_->setHorizontalHeaderLabels(
+            QStringList({"p50", "p99", "max"}));
+    this->solve_timing_table_->setVerticalHeaderLabels(
+            QStringList({"snapshot", "params", "solve", "convert", "emit",
+                         "frame"}));
+    this->solve_timing_table_->verticalHeader()->
+            setSectionResizeMode(QHeaderView::Stretch);
+    this->solve_timing_table_->horizontalHeader()->
+            setSectionResizeMode(QHeaderView::Stretch);
+    this->solve_timing_table_->setEditTriggers(
+            QAbstractItemView::NoEditTriggers);
+    this->solve_timing_table_->setSizePolicy(QSizePolicy::Expanding,
+                                     QSizePolicy::Fixed);
+    this->solve_timing_table_->
+            setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+    this->solve_timing_table_->
+            setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+        // set size
+    this->solve_timing_table_->setMaximumHeight(175);
+        // add table to menu panel
+    panel->menu_->layout()->addWidget(this->solve_timing_table_);
+    panel->menu_->layout()->setAlignment(this->solve_timing_table_,
+                                        Qt::AlignBottom|Qt::AlignCenter);
+
+    // fill cells, times in milliseconds
+    for (quint32 row = 0; row <= NUM_SOLVE_PHASES; row++) {
+        for (quint32 col = 0; col < 3; col++) {
+            this->solve_timing_table_->setItem(row, col,
+                                               new QTableWidgetItem("-"));
+        }
+    }
+
+    connect(this->controller_, SIGNAL(solveTiming()),
+            this, SLOT(updateSolveTiming()));
+
+    // frames are rendered too often to update table each one
+    this->frame_timing_timer_ = new QTimer(this);
+    connect(this->frame_timing_timer_, SIGNAL(timeout()),
+            this, SLOT(updateFrameTiming()));
+    this->frame_timing_timer_->start(1000);
+}
+
 void View::initializeFinaltime(MenuPanel *panel) {
     QDoubleSpinBox *opt_finaltime = new QDoubleSpinBox(panel->menu_);
     opt_finaltime->setSizePolicy(QSizePolicy::Expanding,
@@ -1261,11 +1355,11 @@ void View::initializeFinaltime(MenuPanel *panel) {
     this->panel_widgets_.append(opt_finaltime);
     this->panel_widgets_.append(opt_finaltime_label);
 
-    // free final time updates text box and P.tf
+    // free final time updates text box, P.tf is already
+    // set by the controller
+    this->finaltime_box_ = opt_finaltime;
     connect(this->controller_, SIGNAL(finalTime(double)),
-            this, SLOT(setFinaltime(qreal)));
-    connect(this->controller_, SIGNAL(finalTime(double)),
-            opt_finaltime, SLOT(setValue(qreal)));
+            this, SLOT(showSolvedFinaltime(qreal)));
     // manual change updates P.tf
     connect(opt_finaltime, SIGNAL(valueChanged(double)),
             this, SLOT(setFinaltime(qreal)));
@@ -1325,6 +1419,25 @@ void View::initializeDataCaptureToggle(MenuPanel *panel) {
             this, SLOT(toggleDataCapture(int)));
 }
 
+void View::initializeOpenGLToggle(MenuPanel *panel) {
+    QCheckBox *opengl_toggle =
+            new QCheckBox("OpenGL Render", panel->menu_);
+    opengl_toggle->
+            setToolTip(tr("Render canvas with OpenGL, "
+                          "works without GPU on Mesa llvmpipe"));
+    opengl_toggle->setMinimumHeight(35);
+    opengl_toggle->setCheckState(Qt::Unchecked);
+    panel->menu_->layout()->addWidget(opengl_toggle);
+    panel->menu_->layout()->setAlignment(
+                opengl_toggle, Qt::AlignBottom);
+
+    this->panel_widgets_.append(opengl_toggle);
+
+    // Connect toggle
+    connect(opengl_toggle, SIGNAL(stateChanged(int)),
+            this, SLOT(toggleOpenGL(int)));
+}
+
 void View::initializeFreeFinalTimeToggle(MenuPanel *panel) {
     QCheckBox *free_final_time_toggle =
             new QCheckBox("Free Final Time", panel->menu_);
@@ -1462,4 +1575,30 @@ void View::updateFeedbackMessage() {
     }
 }
 
+void View::updateSolveTiming() {
+    // get timing of current drone from controller
+    SolveTimingStats stats = this->controller_->getSolveTiming();
+
+    // update cells, times in milliseconds
+    for (quint32 row = 0; row < NUM_SOLVE_PHASES; row++) {
+        this->solve_timing_table_->item(row, 0)->
+                setText(QString::number(stats.p50[row], 'f', 2));
+        this->solve_timing_table_->item(row, 1)->
+                setText(QString::number(stats.p99[row], 'f', 2));
+        this->solve_timing_table_->item(row, 2)->
+                setText(QString::number(stats.maximum[row], 'f', 2));
+    }
+}
+
+void View::updateFrameTiming() {
+    // update frame row, times in milliseconds
+    FrameTimingStats stats = this->frame_timing_.getStats();
+    this->solve_timing_table_->item(NUM_SOLVE_PHASES, 0)->
+            setText(QString::number(stats.p50, 'f', 2));
+    this->solve_timing_table_->item(NUM_SOLVE_PHASES, 1)->
+            setText(QString::number(stats.p99, 'f', 2));
+    this->solve_timing_table_->item(NUM_SOLVE_PHASES, 2)->
+            setText(QString::number(stats.maximum, 'f', 2));
+}
+
 }  // namespace optgui
@@ -11,6 +11,8 @@
 #include <QGraphicsView>
 
 #include "include/globals.h"
+#include "include/graphics/graphics_bounds.h"
+#include "include/graphics/level_of_detail.h"
 
 namespace optgui {
 
@@ -43,10 +45,11 @@ WaypointGraphicsItem::WaypointGraphicsItem(PointModelItem *model,
 }
 
 QRectF WaypointGraphicsItem::boundingRect() const {
-    // get rough area circle scaled by zoom factor
+    // get rough area circle and label scaled by zoom factor
     qreal scaling_factor = this->getScalingFactor();
     qreal rad = this->radius_ / scaling_factor;
-    return QRectF(-rad, -rad, rad * 2, rad * 2);
+    return paintedBounds(QRectF(-rad, -rad, rad * 2, rad * 2),
+                         scaling_factor, this->model_->port_ != 0);
 }
 
 void WaypointGraphicsItem::paint(QPainter *painter,
@@ -84,9 +87,10 @@ void WaypointGraphicsItem::paint(QPainter *painter,
         // label with index
         font.setPointSizeF(14 / scaling_factor);
         painter->setFont(font);
-        painter->drawText(this->boundingRect(), Qt::AlignCenter,
+        painter->drawText(QRectF(-rad, -rad, rad * 2, rad * 2),
+                          Qt::AlignCenter,
                           QString::number(this->index_ + 1));
-    } else {
+    } else if (isLabelVisible(scaling_factor)) {
         // Or label with port
         QPointF text_pos(this->mapFromScene(this->model_->getPos()));
         QFont font = painter->font();
@@ -102,14 +106,16 @@ void WaypointGraphicsItem::paint(QPainter *painter,
 }
 
 void WaypointGraphicsItem::setIndex(quint32 index) {
-    // set ordering of waypoint
+    // set ordering of waypoint and re-render label
     this->index_ = index;
+    this->update(this->boundingRect());
 }
 
 QPainterPath WaypointGraphicsItem::shape() const {
     // get shape of circle to draw
     QPainterPath path;
-    path.addEllipse(this->boundingRect());
+    qreal rad = this->radius_ / this->getScalingFactor();
+    path.addEllipse(QRectF(-rad, -rad, rad * 2, rad * 2));
     return path;
 }
 
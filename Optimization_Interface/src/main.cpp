@@ -8,6 +8,7 @@
 #include <QApplication>
 
 #include "include/window/main_window.h"
+#include "include/models/drone_model_item.h"
 
 using optgui::MainWindow;
 
@@ -15,6 +16,8 @@ int main(int argc, char *argv[]) {
     // allow custom packets to be used in signal/slot definitions
     qRegisterMetaType<autogen::packet::traj3dof>("autogen::packet::traj3dof");
     qRegisterMetaType<autogen::packet::telemetry>("autogen::packet::telemetry");
+    // allow vehicle to be queued to network and compute threads
+    qRegisterMetaType<optgui::DroneModelItem *>("DroneModelItem *");
 
     // Initialize application
     QApplication::setAttribute(Qt::AA_EnableHighDpiScaling);
@@ -6,7 +6,6 @@
 #include "include/models/constraint_model.h"
 
 #include <QString>
-#include <QLineF>
 #include <QSpinBox>
 #include <QDoubleSpinBox>
 #include <QtMath>
@@ -18,7 +17,8 @@
 
 namespace optgui {
 
-ConstraintModel::ConstraintModel() : model_lock_(), P_() {
+ConstraintModel::ConstraintModel() : model_lock_(), generation_(),
+    snapshot_(), P_() {
     // Set model containers
     this->curr_drone_ = nullptr;
     this->staged_drone_ = nullptr;
@@ -83,11 +83,15 @@ ConstraintModel::~ConstraintModel() {
 void ConstraintModel::addPoint(PointModelItem *item) {
     QMutexLocker locker(&this->model_lock_);
     this->final_points_.insert(item);
+    item->setGeneration(&this->generation_);
+    this->generation_.bump();
 }
 
 void ConstraintModel::removePoint(PointModelItem *item) {
     QMutexLocker locker(&this->model_lock_);
     this->final_points_.remove(item);
+    item->setGeneration(nullptr);
+    this->generation_.bump();
 }
 
 void ConstraintModel::addDrone(DroneModelItem *drone, PathModelItem *traj) {
@@ -95,6 +99,7 @@ void ConstraintModel::addDrone(DroneModelItem *drone, PathModelItem *traj) {
     this->drones_.insert(drone,
                          QPair<PathModelItem *, autogen::packet::traj3dof>
                                 (traj, autogen::packet::traj3dof()));
+    drone->setGeneration(&this->generation_);
 }
 
 void ConstraintModel::removeDrone(DroneModelItem *item) {
@@ -104,46 +109,63 @@ void ConstraintModel::removeDrone(DroneModelItem *item) {
         this->curr_drone_ = nullptr;
     }
     this->drones_.remove(item);
+    item->setGeneration(nullptr);
 }
 
 void ConstraintModel::addEllipse(EllipseModelItem *item) {
     QMutexLocker locker(&this->model_lock_);
     this->ellipses_.insert(item);
+    item->setGeneration(&this->generation_);
+    this->generation_.bump();
 }
 
 void ConstraintModel::removeEllipse(EllipseModelItem *item) {
     QMutexLocker locker(&this->model_lock_);
     this->ellipses_.remove(item);
+    item->setGeneration(nullptr);
+    this->generation_.bump();
 }
 
 void ConstraintModel::addPolygon(PolygonModelItem *item) {
     QMutexLocker locker(&this->model_lock_);
     this->polygons_.insert(item);
+    item->setGeneration(&this->generation_);
+    this->generation_.bump();
 }
 
 void ConstraintModel::removePolygon(PolygonModelItem *item) {
     QMutexLocker locker(&this->model_lock_);
     this->polygons_.remove(item);
+    item->setGeneration(nullptr);
+    this->generation_.bump();
 }
 
 void ConstraintModel::addPlane(PlaneModelItem *item) {
     QMutexLocker locker(&this->model_lock_);
     this->planes_.insert(item);
+    item->setGeneration(&this->generation_);
+    this->generation_.bump();
 }
 
 void ConstraintModel::removePlane(PlaneModelItem *item) {
     QMutexLocker locker(&this->model_lock_);
     this->planes_.remove(item);
+    item->setGeneration(nullptr);
+    this->generation_.bump();
 }
 
 void ConstraintModel::addWaypoint(PointModelItem *item) {
     QMutexLocker locker(&this->model_lock_);
     this->waypoints_.append(item);
+    item->setGeneration(&this->generation_);
+    this->generation_.bump();
 }
 
 void ConstraintModel::removeWaypoint(PointModelItem *item) {
     QMutexLocker locker(&this->model_lock_);
     this->waypoints_.removeOne(item);
+    item->setGeneration(nullptr);
+    this->generation_.bump();
 }
 
 quint32 ConstraintModel::getNumWaypoints() {
@@ -155,6 +177,7 @@ quint32 ConstraintModel::getNumWaypoints() {
 void ConstraintModel::reverseWaypoints() {
     QMutexLocker locker(&this->model_lock_);
     std::reverse(this->waypoints_.begin(), this->waypoints_.end());
+    this->generation_.bump();
 }
 
 void ConstraintModel::setPathStagedModel(PathModelItem *trajectory) {
@@ -172,14 +195,13 @@ void ConstraintModel::setPathStagedPoints(QVector<QPointF> points) {
     }
 }
 
-bool ConstraintModel::tickPathStaged() {
+void ConstraintModel::trimPathStaged(quint32 size) {
     QMutexLocker locker(&this->model_lock_);
-    // remove first point
     if (this->path_staged_) {
-        this->path_staged_->removePointAt(0);
+        while (this->path_staged_->getSize() > size) {
+            this->path_staged_->removePointAt(0);
+        }
     }
-    // return whether there are more points
-    return this->path_staged_->getSize() != 0;
 }
 
 void ConstraintModel::clearPathStagedPoints() {
@@ -213,6 +235,17 @@ qreal ConstraintModel::getFinaltime() {
 
 void ConstraintModel::setFinaltime(qreal finaltime) {
     QMutexLocker locker(&this->model_lock_);
+    // only flag change if different
+    if (this->P_.tf != finaltime) {
+        this->P_.tf = finaltime;
+        this->generation_.bump();
+    }
+}
+
+void ConstraintModel::setSolvedFinaltime(qreal finaltime) {
+    QMutexLocker locker(&this->model_lock_);
+    // solver output, bumping would re-solve every vehicle
+    // after each solve and never let workers sleep
     this->P_.tf = finaltime;
 }
 
@@ -231,7 +264,7 @@ autogen::packet::traj3dof
 }
 
 void ConstraintModel::setCurrTraj3dof(DroneModelItem *drone,
-                                     autogen::packet::traj3dof traj3dof_data) {
+        autogen::packet::traj3dof const &traj3dof_data) {
     QMutexLocker locker(&this->model_lock_);
     // find drone
     QMap<DroneModelItem *, QPair<PathModelItem *,
@@ -248,6 +281,12 @@ autogen::packet::traj3dof ConstraintModel::getStagedTraj3dof() {
     return this->drone_staged_traj3dof_data_;
 }
 
+QByteArray ConstraintModel::getStagedTrajDatagram() {
+    QMutexLocker locker(&this->model_lock_);
+    // shallow copy, only the reference count changes
+    return this->staged_traj_datagram_;
+}
+
 DroneModelItem *ConstraintModel::getStagedDrone() {
     QMutexLocker locker(&this->model_lock_);
     return this->staged_drone_;
@@ -264,6 +303,17 @@ void ConstraintModel::stageTraj() {
                 this->drones_.find(this->curr_drone_);
         if (iter != this->drones_.end()) {
             this->drone_staged_traj3dof_data_ = (*iter).second;
+
+            // serialize once for every send of staged traj, a datagram
+            // still queued for sending keeps its own buffer, sized
+            // to the traj so any horizon fits
+            autogen::serializable::traj3dof
+                    <autogen::topic::traj3dof::UNDEFINED> ser_data;
+            ser_data = this->drone_staged_traj3dof_data_;
+            this->staged_traj_datagram_.fill(0, ser_data.size());
+            ser_data.serialize(reinterpret_cast<uint8 *>(
+                                   this->staged_traj_datagram_.data()));
+
             this->path_staged_->setPoints((*iter).first->getPoints());
             this->traj_staged_ = true;
         }
@@ -273,6 +323,7 @@ void ConstraintModel::stageTraj() {
 void ConstraintModel::unstageTraj() {
     QMutexLocker locker(&this->model_lock_);
     this->path_staged_->clearPoints();
+    this->staged_traj_datagram_.clear();
     this->traj_staged_ = false;
 }
 
@@ -297,6 +348,7 @@ void ConstraintModel::setClearance(qreal clearance) {
         ellipse->setClearance(clearance);
     }
     this->clearance_ = clearance;
+    this->generation_.bump();
 }
 
 quint32 ConstraintModel::getHorizon() {
@@ -307,6 +359,7 @@ quint32 ConstraintModel::getHorizon() {
 void ConstraintModel::setHorizon(quint32 horizon) {
     QMutexLocker locker(&this->model_lock_);
     this->P_.K = horizon;
+    this->generation_.bump();
 }
 
 bool ConstraintModel::isLiveReference() {
@@ -316,7 +369,11 @@ bool ConstraintModel::isLiveReference() {
 
 void ConstraintModel::setLiveReferenceMode(bool reference_mode) {
     QMutexLocker locker(&this->model_lock_);
-    this->is_live_reference_ = reference_mode;
+    if (this->is_live_reference_ != reference_mode) {
+        this->is_live_reference_ = reference_mode;
+        // wake compute threads paused by live reference
+        this->generation_.bump();
+    }
 }
 
 bool ConstraintModel::isFreeFinalTime() {
@@ -327,6 +384,7 @@ bool ConstraintModel::isFreeFinalTime() {
 void ConstraintModel::setFreeFinalTime(bool free_final_time) {
     QMutexLocker locker(&this->model_lock_);
     this->is_free_final_time_ = free_final_time;
+    this->generation_.bump();
 }
 
 void ConstraintModel::setCurrDrone(DroneModelItem *drone) {
@@ -401,6 +459,8 @@ void ConstraintModel::setSkyeFlyParams(QTableWidget *params_table) {
             (params_table->cellWidget(row_index++, 0))->value();
 //    this->P_.wp_idx[0] = qobject_cast<QSpinBox *>
 //            (params_table->cellWidget(row_index++, 0))->value();
+
+    this->generation_.bump();
 }
 
 skyenet::params ConstraintModel::getSkyeFlyParams() {
@@ -540,15 +600,6 @@ bool ConstraintModel::setIsValidInput(INPUT_CODE code) {
     return new_code;
 }
 
-QVector<QRegion> ConstraintModel::getEllipseRegions() {
-    QMutexLocker locker(&this->model_lock_);
-    QVector<QRegion> regions;
-    for (EllipseModelItem *ellipse : this->ellipses_) {
-        regions.append(ellipse->getRegion());
-    }
-    return regions;
-}
-
 void ConstraintModel::updateEllipseColors() {
     QMutexLocker locker(&this->model_lock_);
 
@@ -565,11 +616,79 @@ void ConstraintModel::updateEllipseColors() {
     }
 }
 
+std::shared_ptr<ConstraintSnapshot const> ConstraintModel::getSnapshot() {
+    // return published snapshot without locking if model unchanged
+    std::shared_ptr<ConstraintSnapshot const> snapshot =
+            std::atomic_load(&this->snapshot_);
+    if (snapshot && snapshot->generation == this->generation_.get()) {
+        return snapshot;
+    }
+
+    QMutexLocker locker(&this->model_lock_);
+    // another compute thread may have published while waiting for lock
+    snapshot = std::atomic_load(&this->snapshot_);
+    quint64 generation = this->generation_.get();
+    if (snapshot && snapshot->generation == generation) {
+        return snapshot;
+    }
+
+    // data models can change outside of model lock, each item is
+    // copied under its own lock. stamp with the generation read
+    // before building so an edit landing mid build leaves the
+    // snapshot stale and it is rebuilt on the next solve
+    std::shared_ptr<ConstraintSnapshot> next =
+            std::make_shared<ConstraintSnapshot>();
+    next->generation = generation;
+    this->buildSnapshot(next.get());
+
+    // publish snapshot
+    snapshot = next;
+    std::atomic_store(&this->snapshot_, snapshot);
+    return snapshot;
+}
+
+// ====== Compute thread wake functions, do not lock model ======
+
+quint64 ConstraintModel::getGeneration() {
+    return this->generation_.get();
+}
+
+quint64 ConstraintModel::getWakeups() {
+    return this->generation_.getWakeups();
+}
+
+void ConstraintModel::waitForChange(quint64 wakeups, unsigned long msecs) {
+    this->generation_.wait(wakeups, msecs);
+}
+
+void ConstraintModel::wakeComputeThreads() {
+    this->generation_.wake();
+}
+
+// ====== Private functions, do not lock ======
+
+void ConstraintModel::buildSnapshot(ConstraintSnapshot *snapshot) {
+    // copy solver inputs into snapshot
+    snapshot->P = this->P_;
+    this->loadEllipseConstraints(&snapshot->P);
+    this->loadPosConstraints(&snapshot->P);
+    this->loadWaypointConstraints(&snapshot->P, snapshot->wp);
+    snapshot->ellipse_index.build(this->getEllipseGeometries());
+    snapshot->is_free_final_time = this->is_free_final_time_;
+}
+
+QVector<EllipseGeometry> ConstraintModel::getEllipseGeometries() {
+    QVector<EllipseGeometry> geometries;
+    geometries.reserve(this->ellipses_.size());
+    for (EllipseModelItem *ellipse : this->ellipses_) {
+        geometries.append(ellipse->getGeometry());
+    }
+    return geometries;
+}
+
 void ConstraintModel::loadWaypointConstraints(
             skyenet::params *P,
             double wp[skyenet::MAX_WAYPOINTS][3]) {
-    QMutexLocker locker(&this->model_lock_);
-
     P->n_wp = this->waypoints_.size();
     // no waypoints, dont factor in relaxation
     if (P->n_wp == 0) {
@@ -590,32 +709,17 @@ void ConstraintModel::loadWaypointConstraints(
 }
 
 void ConstraintModel::loadEllipseConstraints(skyenet::params *P) {
-    QMutexLocker locker(&this->model_lock_);
-
     quint32 index = 0;
     for (EllipseModelItem *ellipse : this->ellipses_) {
-        // calculate ellipse matrix in meters
-
+        // copy cached ellipse matrix in meters
+        EllipseConstraintRow row = ellipse->getConstraintRow();
         P->obs.R[index] = 1;
-        qreal a = (ellipse->getHeight() / GRID_SIZE) + this->clearance_;
-        qreal inv_a = 1.0 / a;
-        qreal b = (ellipse->getWidth() / GRID_SIZE) + this->clearance_;
-        qreal inv_b = 1.0 / b;
-        qreal t = ellipse->getRot();
-        qreal sin_t = qSin(qDegreesToRadians(t));
-        qreal cos_t = qCos(qDegreesToRadians(t));
-        qreal cos_t_2 = qPow(cos_t, 2);
-        qreal sin_t_2 = qPow(sin_t, 2);
-
-        P->obs.M0[0][index] = (inv_a * cos_t_2) + (inv_b * sin_t_2);
-        P->obs.M0[1][index] = (inv_a * sin_t * cos_t) - (inv_b * sin_t * cos_t);
-        P->obs.M1[0][index] = (inv_a * sin_t * cos_t) - (inv_b * sin_t * cos_t);
-        P->obs.M1[1][index] = (inv_a * sin_t_2) + (inv_b * cos_t_2);
-
-        QPointF ellipse_pos = ellipse->getPos();
-        QVector3D xyz_coords = guiXyzToXyz(ellipse_pos.x(), ellipse_pos.y(), 0);
-        P->obs.c_x[index] = xyz_coords.x();
-        P->obs.c_y[index] = xyz_coords.y();
+        P->obs.M0[0][index] = row.M0[0];
+        P->obs.M0[1][index] = row.M0[1];
+        P->obs.M1[0][index] = row.M1[0];
+        P->obs.M1[1][index] = row.M1[1];
+        P->obs.c_x[index] = row.c_x;
+        P->obs.c_y[index] = row.c_y;
         index++;
         // dont go over max
         if (index >= skyenet::MAX_OBS) {
@@ -627,21 +731,14 @@ void ConstraintModel::loadEllipseConstraints(skyenet::params *P) {
 }
 
 void ConstraintModel::loadPosConstraints(skyenet::params *P) {
-    QMutexLocker locker(&this->model_lock_);
-
     quint32 index = 0;
     for (PolygonModelItem *polygon : this->polygons_) {
-        quint32 size = polygon->getSize();
-        for (quint32 i = 1; i < size + 1; i++) {
-            QPointF p_pos = polygon->getPointAt(i - 1);
-            QPointF q_pos = polygon->getPointAt(i % size);
-            QVector3D xyz_p = guiXyzToXyz(p_pos.x(), p_pos.y(), 0);
-            QVector3D xyz_q = guiXyzToXyz(q_pos.x(), q_pos.y(), 0);
-            if (polygon->getDirection()) {
-                this->loadPlaneConstraint(P, index, xyz_p, xyz_q);
-            } else {
-                this->loadPlaneConstraint(P, index, xyz_q, xyz_p);
-            }
+        // copy cached half plane for each edge, const to avoid
+        // detaching the shared rows
+        QVector<PlaneConstraintRow> const rows =
+                polygon->getConstraintRows();
+        for (PlaneConstraintRow const &row : rows) {
+            this->loadPlaneConstraint(P, index, row);
             index++;
             // dont go over max
             if (index >= skyenet::MAX_CPOS) {
@@ -652,17 +749,8 @@ void ConstraintModel::loadPosConstraints(skyenet::params *P) {
     }
 
     for (PlaneModelItem *plane : this->planes_) {
-        QPointF p1_pos = plane->getP1();
-        QPointF p2_pos = plane->getP2();
-        QVector3D xyz_p = guiXyzToXyz(p1_pos.x(), p1_pos.y(), 0);
-        QVector3D xyz_q = guiXyzToXyz(p2_pos.x(), p2_pos.y(), 0);
-
-        // choose direction of constraint
-        if (plane->getDirection()) {
-            this->loadPlaneConstraint(P, index, xyz_p, xyz_q);
-        } else {
-            this->loadPlaneConstraint(P, index, xyz_q, xyz_p);
-        }
+        // copy cached half plane
+        this->loadPlaneConstraint(P, index, plane->getConstraintRow());
         index++;
         // dont go over max
         if (index >= skyenet::MAX_CPOS) {
@@ -673,23 +761,11 @@ void ConstraintModel::loadPosConstraints(skyenet::params *P) {
     P->cpos.n = index;
 }
 
-// ====== Private functions, do not lock ======
-
 void ConstraintModel::loadPlaneConstraint(skyenet::params *P, quint32 index,
-                                          QVector3D xyz_p, QVector3D xyz_q) {
-    qreal c = ((xyz_q.x() * xyz_p.y()) - (xyz_q.y() * xyz_p.x()));
-
-    qreal a1 = (xyz_q.x() - xyz_p.x()) / c;
-    qreal a2 = (xyz_q.y() - xyz_p.y()) / c * -1.0;
-
-    QLineF line(QPointF(xyz_q.x(), xyz_q.y()),
-                QPointF(xyz_p.x(), xyz_p.y()));
-    QPointF normal = line.normalVector().p2();
-    qreal flip = ((a1 * normal.y()) + (a2 * normal.x()) < 1) ? -1 : 1;
-
-    P->cpos.A[2 * index] = flip * a1;
-    P->cpos.A[(2 * index) + 1] = flip * a2;
-    P->cpos.b[index] = flip;
+                                          PlaneConstraintRow const &row) {
+    P->cpos.A[2 * index] = row.A[0];
+    P->cpos.A[(2 * index) + 1] = row.A[1];
+    P->cpos.b[index] = row.b;
 }
 
 int ConstraintModel::distributeWpEvenly(skyenet::params *P,
@@ -0,0 +1,118 @@
+// TITLE:   Optimization_Interface/src/models/ellipse_index.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/models/ellipse_index.h"
+
+#include <QtMath>
+
+namespace optgui {
+
+// smallest cell width in pixels
+qreal const ELLIPSE_INDEX_MIN_CELL = 10;
+
+EllipseIndex::EllipseIndex() : ellipses_(), bounds_(), cells_(),
+    cell_size_(ELLIPSE_INDEX_MIN_CELL), has_overlap_(false) {
+}
+
+void EllipseIndex::build(QVector<EllipseGeometry> const &ellipses) {
+    this->ellipses_ = ellipses;
+    this->bounds_.clear();
+    this->bounds_.reserve(ellipses.size());
+    this->cells_.clear();
+
+    // size cells to average obstacle so most span few cells
+    qreal total_size = 0;
+    for (EllipseGeometry const &ellipse : this->ellipses_) {
+        QRectF bounds = ellipse.boundingRect();
+        this->bounds_.append(bounds);
+        total_size += qMax(bounds.width(), bounds.height());
+    }
+    this->cell_size_ = ELLIPSE_INDEX_MIN_CELL;
+    if (!this->ellipses_.isEmpty()) {
+        this->cell_size_ = qMax(ELLIPSE_INDEX_MIN_CELL,
+                                total_size / this->ellipses_.size());
+    }
+
+    // insert each ellipse in every cell its bounding rect touches
+    for (int i = 0; i < this->bounds_.size(); i++) {
+        QRectF const &bounds = this->bounds_.at(i);
+        qint32 min_col = this->getCellCoord(bounds.left());
+        qint32 max_col = this->getCellCoord(bounds.right());
+        qint32 min_row = this->getCellCoord(bounds.top());
+        qint32 max_row = this->getCellCoord(bounds.bottom());
+        for (qint32 col = min_col; col <= max_col; col++) {
+            for (qint32 row = min_row; row <= max_row; row++) {
+                this->cells_[this->getCellKey(col, row)].append(i);
+            }
+        }
+    }
+
+    this->has_overlap_ = this->findOverlap();
+}
+
+bool EllipseIndex::contains(QPointF const &point) const {
+    // only check ellipses in cell containing point
+    quint64 key = this->getCellKey(this->getCellCoord(point.x()),
+                                   this->getCellCoord(point.y()));
+    QHash<quint64, QVector<int>>::const_iterator iter =
+            this->cells_.find(key);
+    if (iter == this->cells_.end()) return false;
+
+    for (int i : *iter) {
+        // check cheaply in rect, then in ellipse
+        if (this->bounds_.at(i).contains(point) &&
+                this->ellipses_.at(i).contains(point)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool EllipseIndex::hasOverlap() const {
+    return this->has_overlap_;
+}
+
+qint32 EllipseIndex::getCellCoord(qreal coord) const {
+    return static_cast<qint32>(qFloor(coord / this->cell_size_));
+}
+
+quint64 EllipseIndex::getCellKey(qint32 col, qint32 row) const {
+    return (static_cast<quint64>(static_cast<quint32>(col)) << 32) |
+            static_cast<quint32>(row);
+}
+
+bool EllipseIndex::findOverlap() const {
+    // only pairs sharing a cell can overlap
+    for (QHash<quint64, QVector<int>>::const_iterator iter =
+         this->cells_.begin(); iter != this->cells_.end(); iter++) {
+        QVector<int> const &cell = *iter;
+        for (int i = 0; i < cell.size(); i++) {
+            QRectF const &bounds_i = this->bounds_.at(cell.at(i));
+            for (int j = i + 1; j < cell.size(); j++) {
+                QRectF const &bounds_j = this->bounds_.at(cell.at(j));
+                // First look at intersection of bounding rects
+                // (cheaper to do)
+                if (!bounds_i.intersects(bounds_j)) continue;
+
+                // test each pair once, in the cell holding the
+                // corner of the intersection of their bounding rects
+                QRectF shared = bounds_i.intersected(bounds_j);
+                quint64 shared_key = this->getCellKey(
+                            this->getCellCoord(shared.left()),
+                            this->getCellCoord(shared.top()));
+                if (shared_key != iter.key()) continue;
+
+                // If bounding rect overlaps, then check exact intersection
+                if (this->ellipses_.at(cell.at(i)).overlaps(
+                            this->ellipses_.at(cell.at(j)))) {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+}  // namespace optgui
@@ -5,13 +5,22 @@
 
 #include "include/network/drone_socket.h"
 
+#include <cstring>
+
 #include "include/globals.h"
 
 namespace optgui {
 
-DroneSocket::DroneSocket(DroneGraphicsItem *model, QObject *parent)
-    : QUdpSocket(parent) {
+DroneSocket::DroneSocket(DroneGraphicsItem *model, bool is_chunked,
+                         FlightRecordQueue *records, QObject *parent)
+    : QUdpSocket(parent), buffer_used_(0), uplink_(nullptr),
+      records_(records) {
     this->drone_item_ = model;
+    if (is_chunked) {
+        // deleted with socket
+        this->uplink_ = new TrajUplink(this);
+    }
+    std::memset(this->buffer_, 0, DRONE_SOCKET_BUFFER_SIZE);
     this->bind(QHostAddress::AnyIPv4, this->drone_item_->model_->port_);
 
     // automatically read incoming data with slots
@@ -24,68 +33,102 @@ DroneSocket::~DroneSocket() {
 }
 
 void DroneSocket::readPendingDatagrams() {
+    // drain all queued datagrams, only newest telemetry is applied
+    bool has_telemetry = false;
+    QVector3D gui_coords;
+    QVector3D gui_vels;
+    QVector3D gui_accels;
+    qint64 stamp_nsecs = 0;
+
     while (this->hasPendingDatagrams()) {
-        // allocate buffer
-        char buffer[4000] = {0};
         QHostAddress address;
         quint16 port;
-        int64 bytes_read = this->readDatagram(buffer, 4000, &address, &port);
+        int64 bytes_read = this->readDatagram(this->buffer_,
+                                              DRONE_SOCKET_BUFFER_SIZE,
+                                              &address, &port);
 
         if (bytes_read > 0) {
+            // zero bytes left over from a longer datagram,
+            // instead of clearing the whole buffer each read
+            if (bytes_read < this->buffer_used_) {
+                std::memset(this->buffer_ + bytes_read, 0,
+                            this->buffer_used_ - bytes_read);
+            }
+            this->buffer_used_ = bytes_read;
+
+            // consume trajectory chunk acks
+            if (this->uplink_ && this->uplink_->receiveAck(
+                        this->buffer_, bytes_read, address, port)) {
+                continue;
+            }
+
+            // stamp on receipt, before deserialization cost
+            qint64 receipt_nsecs = monotonicNsecs();
+
             // deserialize data into telemetry packet
             autogen::deserializable::telemetry
                   <autogen::topic::telemetry::UNDEFINED> telemetry_data;
             // pointer is NULL if does not deserialize correctly
             const uint8 *ptr_telemetry_data =
                     telemetry_data.deserialize(
-                        reinterpret_cast<const uint8 *>(buffer));
+                        reinterpret_cast<const uint8 *>(this->buffer_));
             if (ptr_telemetry_data != NULL) {
-                QVector3D gui_coords =
-                        nedToGuiXyz(telemetry_data.pos_ned(0),
-                                    telemetry_data.pos_ned(1),
-                                    telemetry_data.pos_ned(2));
-                QVector3D gui_vels =
-                        nedToGuiXyz(telemetry_data.vel_ned(0),
-                                    telemetry_data.vel_ned(1),
-                                    0);  // hard code velocity
-                QVector3D gui_accels =
-                        nedToGuiXyz(telemetry_data.accl_b(0),
-                                    telemetry_data.accl_b(1),
-                                    -9.81);  // hard code gravity
-                // set model telem
-                this->drone_item_->model_->setPos(gui_coords);
-                this->drone_item_->model_->setVel(gui_vels);
-                this->drone_item_->model_->setAccel(gui_accels);
-                // set graphics coords so view knows whether to paint it
-                this->drone_item_->setPos(QPointF(gui_coords.x(),
-                                                  gui_coords.y()));
-                emit refresh_graphics();
+                gui_coords = nedToGuiXyz(telemetry_data.pos_ned(0),
+                                         telemetry_data.pos_ned(1),
+                                         telemetry_data.pos_ned(2));
+                gui_vels = nedToGuiXyz(telemetry_data.vel_ned(0),
+                                       telemetry_data.vel_ned(1),
+                                       0);  // hard code velocity
+                gui_accels = nedToGuiXyz(telemetry_data.accl_b(0),
+                                         telemetry_data.accl_b(1),
+                                         -9.81);  // hard code gravity
+                stamp_nsecs = receipt_nsecs;
+                has_telemetry = true;
+
+                // record every packet, not only the newest
+                if (this->records_) {
+                    this->records_->push(FlightRecorder::telemetryRecord(
+                            this->drone_item_->model_->port_, receipt_nsecs,
+                            gui_coords, gui_vels, gui_accels));
+                }
             }
         }
     }
+
+    if (has_telemetry) {
+        // set model telem in one update
+        this->drone_item_->model_->setState(gui_coords, gui_vels,
+                                            gui_accels, stamp_nsecs);
+        // one refresh per drain, graphics synced on GUI thread
+        emit refresh_graphics();
+    }
 }
 
-void DroneSocket::rx_trajectory(DroneModelItem *drone,
-                                const autogen::packet::traj3dof data) {
+void DroneSocket::rx_trajectory(DroneModelItem *drone, QByteArray datagram) {
     if (drone == this->drone_item_->model_) {
-        autogen::serializable::traj3dof
-                <autogen::topic::traj3dof::UNDEFINED> ser_data;
-        ser_data = data;
-        char buffer[4096] = {0};
-        ser_data.serialize(reinterpret_cast<uint8 *>(buffer));
-
-        if (this->isDestinationAddrValid()) {
-            this->writeDatagram(buffer, ser_data.size(),
-                    QHostAddress(this->drone_item_->model_->ip_addr_),
-                    this->drone_item_->model_->destination_port_);
-        }
+        DroneSocket::writeTrajectory(this, drone, datagram, this->uplink_);
+    }
+}
+
+void DroneSocket::writeTrajectory(QUdpSocket *socket, DroneModelItem *drone,
+                                  QByteArray const &datagram,
+                                  TrajUplink *uplink) {
+    // datagram was serialized once when staged
+    if (datagram.isEmpty() || !DroneSocket::isDestinationAddrValid(drone)) {
+        return;
+    }
+    if (uplink) {
+        uplink->send(datagram, QHostAddress(drone->ip_addr_),
+                     drone->destination_port_);
+    } else {
+        socket->writeDatagram(datagram, QHostAddress(drone->ip_addr_),
+                              drone->destination_port_);
     }
 }
 
-bool DroneSocket::isDestinationAddrValid() {
+bool DroneSocket::isDestinationAddrValid(DroneModelItem *drone) {
     // validate ip address is long enough
-    QStringList ip_addr_sections_ =
-            this->drone_item_->model_->ip_addr_.split(".");
+    QStringList ip_addr_sections_ = drone->ip_addr_.split(".");
     if (ip_addr_sections_.size() != 4) {
         return false;
     }
@@ -100,7 +143,7 @@ bool DroneSocket::isDestinationAddrValid() {
     }
 
     // validate destination port is valid
-    quint16 value = this->drone_item_->model_->destination_port_;
+    quint16 value = drone->destination_port_;
     if (1024 > value || value > 65535) {
         return false;
     }
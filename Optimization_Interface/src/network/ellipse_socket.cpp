@@ -49,8 +49,7 @@ void EllipseSocket::readPendingDatagrams() {
 
                 // set model pos
                 this->ellipse_item_->model_->setPos(gui_coords_2D);
-                // set graphics pos so view knows whether to paint it
-                this->ellipse_item_->setPos(gui_coords_2D);
+                // graphics synced on GUI thread
                 emit refresh_graphics();
             }
         }
@@ -0,0 +1,246 @@
+// TITLE:   Optimization_Interface/src/network/mux_socket.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/network/mux_socket.h"
+
+#include <QtEndian>
+
+#include <cstring>
+
+#include "include/network/drone_socket.h"
+#include "include/globals.h"
+
+namespace optgui {
+
+MuxSocket::MuxSocket(Canvas *canvas, quint16 port, bool is_chunked,
+                     FlightRecordQueue *records, QObject *parent)
+    : QUdpSocket(parent), mutex_(), routes_(), buffer_used_(0),
+      pending_(), is_chunked_(is_chunked), uplinks_(), records_(records) {
+    std::memset(this->buffer_, 0, MUX_SOCKET_BUFFER_SIZE);
+
+    // route objects by configured port
+    for (DroneGraphicsItem *graphic : canvas->drone_graphics_) {
+        this->addRoute(DRONE_ROUTE, graphic, graphic->model_);
+    }
+    for (PointGraphicsItem *graphic : canvas->final_points_) {
+        this->addRoute(TARGET_ROUTE, graphic, graphic->model_);
+    }
+    for (WaypointGraphicsItem *graphic : canvas->waypoint_graphics_) {
+        this->addRoute(WAYPOINT_ROUTE, graphic, graphic->model_);
+    }
+    for (EllipseGraphicsItem *graphic : canvas->ellipse_graphics_) {
+        this->addRoute(ELLIPSE_ROUTE, graphic, graphic->model_);
+    }
+
+    this->bind(QHostAddress::AnyIPv4, port);
+
+    // automatically read incoming data with slots
+    connect(this, SIGNAL(readyRead()), this, SLOT(readPendingDatagrams()));
+}
+
+MuxSocket::~MuxSocket() {
+    // close UDP socket
+    this->close();
+    // acquire lock to destroy it
+    QMutexLocker locker(&this->mutex_);
+}
+
+void MuxSocket::addRoute(MUX_ROUTE type, QGraphicsItem *item,
+                         DataModel *model) {
+    // objects without a port are not networked
+    if (model->port_ > 0) {
+        MuxRoute route = {type, item, model};
+        this->routes_.insert(model->port_, route);
+    }
+}
+
+void MuxSocket::removeRoute(DataModel *model) {
+    QMutexLocker locker(&this->mutex_);
+    // search by model, port may have changed since routing
+    QHash<quint16, MuxRoute>::iterator iter = this->routes_.begin();
+    while (iter != this->routes_.end()) {
+        if (iter->model == model) {
+            iter = this->routes_.erase(iter);
+        } else {
+            iter++;
+        }
+    }
+}
+
+void MuxSocket::syncGraphics() {
+    QMutexLocker locker(&this->mutex_);
+    // set graphics coords so view knows whether to paint them
+    for (MuxRoute const &route : this->routes_) {
+        switch (route.type) {
+            case DRONE_ROUTE: {
+                DroneGraphicsItem *graphic =
+                        static_cast<DroneGraphicsItem *>(route.item);
+                QVector3D pos = graphic->model_->getPos();
+                graphic->setPos(QPointF(pos.x(), pos.y()));
+                break;
+            }
+            case TARGET_ROUTE: {
+                PointGraphicsItem *graphic =
+                        static_cast<PointGraphicsItem *>(route.item);
+                graphic->setPos(graphic->model_->getPos());
+                break;
+            }
+            case WAYPOINT_ROUTE: {
+                WaypointGraphicsItem *graphic =
+                        static_cast<WaypointGraphicsItem *>(route.item);
+                graphic->setPos(graphic->model_->getPos());
+                break;
+            }
+            case ELLIPSE_ROUTE: {
+                EllipseGraphicsItem *graphic =
+                        static_cast<EllipseGraphicsItem *>(route.item);
+                graphic->setPos(graphic->model_->getPos());
+                break;
+            }
+        }
+    }
+}
+
+void MuxSocket::readPendingDatagrams() {
+    // drain all queued datagrams, only newest telemetry of each
+    // object is applied. routes are locked only for lookups and
+    // updates so GUI graphics syncs never wait on socket reads
+    while (this->hasPendingDatagrams()) {
+        QHostAddress address;
+        quint16 port;
+        int64 bytes_read = this->readDatagram(this->buffer_,
+                                              MUX_SOCKET_BUFFER_SIZE,
+                                              &address, &port);
+
+        if (bytes_read > MUX_HEADER_SIZE) {
+            // zero bytes left over from a longer datagram
+            if (bytes_read < this->buffer_used_) {
+                std::memset(this->buffer_ + bytes_read, 0,
+                            this->buffer_used_ - bytes_read);
+            }
+            this->buffer_used_ = bytes_read;
+
+            // consume trajectory chunk acks
+            bool is_ack = false;
+            for (TrajUplink *uplink : this->uplinks_) {
+                if (uplink->receiveAck(this->buffer_, bytes_read,
+                                       address, port)) {
+                    is_ack = true;
+                    break;
+                }
+            }
+            if (is_ack) continue;
+            // stamp on receipt, before deserialization cost
+            qint64 receipt_nsecs = monotonicNsecs();
+
+            // look up object by id header
+            quint16 id = qFromBigEndian<quint16>(
+                        reinterpret_cast<const uchar *>(this->buffer_));
+            MUX_ROUTE type;
+            {
+                QMutexLocker locker(&this->mutex_);
+                QHash<quint16, MuxRoute>::const_iterator iter =
+                        this->routes_.constFind(id);
+                if (iter == this->routes_.constEnd()) {
+                    continue;
+                }
+                type = iter->type;
+            }
+
+            // deserialize telemetry following header
+            autogen::deserializable::telemetry
+                  <autogen::topic::telemetry::UNDEFINED> telemetry_data;
+            // pointer is NULL if does not deserialize correctly
+            const uint8 *ptr_telemetry_data =
+                    telemetry_data.deserialize(
+                        reinterpret_cast<const uint8 *>(
+                            this->buffer_ + MUX_HEADER_SIZE));
+            if (ptr_telemetry_data != NULL) {
+                MuxTelemetry telemetry;
+                telemetry.pos = nedToGuiXyz(telemetry_data.pos_ned(0),
+                                            telemetry_data.pos_ned(1),
+                                            telemetry_data.pos_ned(2));
+                telemetry.vel = nedToGuiXyz(telemetry_data.vel_ned(0),
+                                            telemetry_data.vel_ned(1),
+                                            0);  // hard code velocity
+                telemetry.accel = nedToGuiXyz(telemetry_data.accl_b(0),
+                                              telemetry_data.accl_b(1),
+                                              -9.81);  // hard code gravity
+                telemetry.stamp_nsecs = receipt_nsecs;
+                this->pending_.insert(id, telemetry);
+
+                // record every vehicle packet, not only the newest
+                if (type == DRONE_ROUTE && this->records_) {
+                    this->records_->push(FlightRecorder::telemetryRecord(
+                            id, receipt_nsecs, telemetry.pos,
+                            telemetry.vel, telemetry.accel));
+                }
+            }
+        }
+    }
+
+    if (!this->pending_.isEmpty()) {
+        // set each model in one update, route may have been
+        // removed since lookup
+        QMutexLocker locker(&this->mutex_);
+        QHash<quint16, MuxTelemetry>::const_iterator pending =
+                this->pending_.constBegin();
+        for (; pending != this->pending_.constEnd(); pending++) {
+            QHash<quint16, MuxRoute>::const_iterator iter =
+                    this->routes_.constFind(pending.key());
+            if (iter != this->routes_.constEnd()) {
+                this->dispatch(*iter, pending.value());
+            }
+        }
+        locker.unlock();
+        this->pending_.clear();
+        // one refresh per drain, graphics synced on GUI thread
+        emit refresh_graphics();
+    }
+}
+
+void MuxSocket::dispatch(MuxRoute const &route,
+                         MuxTelemetry const &telemetry) {
+    switch (route.type) {
+        case DRONE_ROUTE: {
+            static_cast<DroneModelItem *>(route.model)->setState(
+                        telemetry.pos, telemetry.vel, telemetry.accel,
+                        telemetry.stamp_nsecs);
+            break;
+        }
+        case TARGET_ROUTE:
+        case WAYPOINT_ROUTE: {
+            static_cast<PointModelItem *>(route.model)->setPos(
+                        QPointF(telemetry.pos.x(), telemetry.pos.y()));
+            break;
+        }
+        case ELLIPSE_ROUTE: {
+            static_cast<EllipseModelItem *>(route.model)->setPos(
+                        QPointF(telemetry.pos.x(), telemetry.pos.y()));
+            break;
+        }
+    }
+}
+
+void MuxSocket::rx_trajectory(DroneModelItem *drone, QByteArray datagram) {
+    QMutexLocker locker(&this->mutex_);
+    // send only to routed vehicles
+    QHash<quint16, MuxRoute>::const_iterator iter =
+            this->routes_.constFind(drone->port_);
+    if (iter == this->routes_.constEnd() || iter->model != drone) return;
+
+    TrajUplink *uplink = nullptr;
+    if (this->is_chunked_) {
+        uplink = this->uplinks_.value(drone->port_, nullptr);
+        if (!uplink) {
+            // deleted with socket
+            uplink = new TrajUplink(this);
+            this->uplinks_.insert(drone->port_, uplink);
+        }
+    }
+    DroneSocket::writeTrajectory(this, drone, datagram, uplink);
+}
+
+}  // namespace optgui
@@ -0,0 +1,42 @@
+// TITLE:   Optimization_Interface/src/network/network_thread.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/network/network_thread.h"
+
+namespace optgui {
+
+void SocketCloser::closeSocket(QObject *socket) {
+    // socket destructor closes UDP socket
+    delete socket;
+}
+
+NetworkThread::NetworkThread(QObject *parent)
+    : QThread(parent) {
+    this->closer_ = new SocketCloser();
+    this->closer_->moveToThread(this);
+
+    // run event loop until destroyed
+    this->start();
+}
+
+NetworkThread::~NetworkThread() {
+    // stop event loop, sockets must already be removed
+    this->quit();
+    this->wait();
+    delete this->closer_;
+}
+
+void NetworkThread::addSocket(QUdpSocket *socket) {
+    // socket notifiers follow socket to network thread
+    socket->moveToThread(this);
+}
+
+void NetworkThread::removeSocket(QUdpSocket *socket) {
+    QMetaObject::invokeMethod(this->closer_, "closeSocket",
+                              Qt::BlockingQueuedConnection,
+                              Q_ARG(QObject *, socket));
+}
+
+}  // namespace optgui
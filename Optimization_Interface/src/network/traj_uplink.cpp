@@ -0,0 +1,98 @@
+// TITLE:   Optimization_Interface/src/network/traj_uplink.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/network/traj_uplink.h"
+
+#include <cstring>
+
+namespace optgui {
+
+TrajUplink::TrajUplink(QUdpSocket *socket)
+    : QObject(socket), socket_(socket), datagram_(), address_(),
+      port_(0), transfer_(0), num_chunks_(0), acked_(),
+      num_unacked_(0), attempts_(0) {
+    this->resend_timer_ = new QTimer(this);
+    connect(this->resend_timer_, SIGNAL(timeout()),
+            this, SLOT(resend()));
+}
+
+void TrajUplink::send(QByteArray const &datagram,
+                      QHostAddress const &address, quint16 port) {
+    // new transfer id so late acks of old transfer are ignored
+    this->transfer_++;
+    this->datagram_ = datagram;
+    this->address_ = address;
+    this->port_ = port;
+
+    // split into chunks, empty traj is not sent
+    this->num_chunks_ = static_cast<quint16>(
+                (datagram.size() + TRAJ_CHUNK_PAYLOAD_SIZE - 1)
+                / TRAJ_CHUNK_PAYLOAD_SIZE);
+    this->acked_.fill(false, this->num_chunks_);
+    this->num_unacked_ = this->num_chunks_;
+    this->attempts_ = 0;
+    this->resend_timer_->stop();
+
+    this->resend();
+}
+
+bool TrajUplink::receiveAck(char const *data, qint64 size,
+                            QHostAddress const &address, quint16 port) {
+    quint16 transfer = 0;
+    quint16 index = 0;
+    if (!readTrajAck(data, size, &transfer, &index) ||
+            address != this->address_ || port != this->port_) {
+        return false;
+    }
+
+    // ack of current transfer, duplicates are consumed
+    if (transfer == this->transfer_ && index < this->num_chunks_ &&
+            !this->acked_.at(index)) {
+        this->acked_[index] = true;
+        this->num_unacked_--;
+        if (this->num_unacked_ == 0) {
+            // all chunks received
+            this->resend_timer_->stop();
+        }
+    }
+    return true;
+}
+
+void TrajUplink::resend() {
+    // give up on vehicle not acknowledging
+    if (this->num_unacked_ == 0 ||
+            this->attempts_ >= TRAJ_UPLINK_MAX_ATTEMPTS) {
+        this->resend_timer_->stop();
+        return;
+    }
+    this->attempts_++;
+
+    // selectively send chunks still missing
+    for (quint16 i = 0; i < this->num_chunks_; i++) {
+        if (!this->acked_.at(i)) {
+            this->writeChunk(i);
+        }
+    }
+    this->resend_timer_->start(TRAJ_UPLINK_RESEND_MS);
+}
+
+void TrajUplink::writeChunk(quint16 index) {
+    qint64 offset = index * TRAJ_CHUNK_PAYLOAD_SIZE;
+    qint64 length = qMin(TRAJ_CHUNK_PAYLOAD_SIZE,
+                         this->datagram_.size() - offset);
+
+    // header followed by slice of serialized traj
+    char chunk[TRAJ_CHUNK_HEADER_SIZE + TRAJ_CHUNK_PAYLOAD_SIZE];
+    TrajChunkHeader header = {this->transfer_, index, this->num_chunks_,
+                              static_cast<quint16>(length)};
+    writeTrajChunkHeader(header, chunk);
+    std::memcpy(chunk + TRAJ_CHUNK_HEADER_SIZE,
+                this->datagram_.constData() + offset, length);
+
+    this->socket_->writeDatagram(chunk, TRAJ_CHUNK_HEADER_SIZE + length,
+                                 this->address_, this->port_);
+}
+
+}  // namespace optgui
@@ -48,8 +48,7 @@ void WaypointSocket::readPendingDatagrams() {
                                                 gui_coords_3D.y());
                 // set model coords
                 this->waypoint_item_->model_->setPos(gui_coords_2D);
-                // set graphics coords so view knows to render it
-                this->waypoint_item_->setPos(gui_coords_2D);
+                // graphics synced on GUI thread
                 emit refresh_graphics();
             }
         }
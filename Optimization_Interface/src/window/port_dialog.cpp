@@ -6,10 +6,12 @@
 #include "include/window/port_dialog.h"
 
 #include <QVBoxLayout>
+#include <QHBoxLayout>
 #include <QBoxLayout>
 #include <QHeaderView>
 
 #include "include/window/port_dialog/port_selector.h"
+#include "include/network/mux_socket.h"
 
 namespace optgui {
 
@@ -42,6 +44,13 @@ PortDialog::~PortDialog() {
     this->layout()->removeWidget(this->drone_table_);
     delete this->drone_table_;
 
+    // deletes multiplex toggle and port
+    this->layout()->removeWidget(this->multiplex_row_);
+    delete this->multiplex_row_;
+
+    this->layout()->removeWidget(this->chunked_box_);
+    delete this->chunked_box_;
+
     delete this->layout();
 }
 
@@ -51,6 +60,18 @@ void PortDialog::fillTable(ConstraintModel *model) {
                             this->ports_);
 }
 
+bool PortDialog::isMultiplexed() {
+    return this->multiplex_box_->isChecked();
+}
+
+quint16 PortDialog::getMultiplexPort() {
+    return static_cast<quint16>(this->multiplex_port_box_->value());
+}
+
+bool PortDialog::isChunkedUplink() {
+    return this->chunked_box_->isChecked();
+}
+
 void PortDialog::resetTable() {
     // table takes ownership of pointers and deletes them
     this->port_table_->clearContents();
@@ -59,6 +80,29 @@ void PortDialog::resetTable() {
 }
 
 void PortDialog::initializeTable() {
+    // Create multiplex toggle, ports become object ids when checked
+    this->multiplex_row_ = new QWidget(this);
+    this->multiplex_row_->setLayout(new QHBoxLayout(this->multiplex_row_));
+    this->multiplex_row_->layout()->setContentsMargins(0, 0, 0, 0);
+    this->multiplex_box_ = new QCheckBox(tr("Receive all on port"),
+                                         this->multiplex_row_);
+    this->multiplex_box_->setToolTip(
+                tr("Telemetry is prefixed with the object port as id"));
+    this->multiplex_port_box_ = new QSpinBox(this->multiplex_row_);
+    this->multiplex_port_box_->setRange(1, 65535);
+    this->multiplex_port_box_->setValue(MUX_SOCKET_DEFAULT_PORT);
+    this->multiplex_port_box_->setEnabled(false);
+    this->connect(this->multiplex_box_, SIGNAL(toggled(bool)),
+                  this->multiplex_port_box_, SLOT(setEnabled(bool)));
+    this->multiplex_row_->layout()->addWidget(this->multiplex_box_);
+    this->multiplex_row_->layout()->addWidget(this->multiplex_port_box_);
+
+    // Create chunked uplink toggle, vehicle must acknowledge chunks
+    this->chunked_box_ = new QCheckBox(tr("Chunked trajectory uplink"),
+                                       this);
+    this->chunked_box_->setToolTip(
+                tr("Trajectories are sent in chunks resent until acked"));
+
     // Create tables
     this->port_table_ = new QTableWidget(this);
     this->drone_table_ = new QTableWidget(this);
@@ -99,6 +143,8 @@ void PortDialog::initializeTable() {
     this->setPalette(palette);
 
     // Add to layout
+    this->layout()->addWidget(this->multiplex_row_);
+    this->layout()->addWidget(this->chunked_box_);
     this->layout()->addWidget(this->drone_table_);
     this->layout()->addWidget(this->port_table_);
 }
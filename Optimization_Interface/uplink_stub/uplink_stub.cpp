@@ -0,0 +1,142 @@
+// TITLE:   Optimization_Interface/uplink_stub/uplink_stub.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Stands in for a vehicle receiving chunked trajectory uplink,
+// acknowledges chunks and reassembles the traj3dof packet.
+// Chunks can be dropped to exercise selective resend.
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QUdpSocket>
+#include <QTextStream>
+#include <QVector>
+
+#include <cstring>
+#include <random>
+
+#include "autogen/lib.h"
+
+#include "include/network/traj_chunk.h"
+
+using optgui::TrajChunkHeader;
+
+// transfer being reassembled
+struct Reassembly {
+    quint16 transfer;
+    QByteArray data;
+    QVector<bool> received;
+    quint16 num_received;
+    qint64 size;
+};
+
+int main(int argc, char *argv[]) {
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("Optimization_Interface_Uplink_Stub");
+
+    // parse options
+    QCommandLineParser parser;
+    parser.setApplicationDescription(
+            "Acknowledge chunked trajectory uplink like a vehicle");
+    parser.addHelpOption();
+    QCommandLineOption port_option(QStringList({"p", "port"}),
+            "Vehicle listening port.", "port", "6000");
+    QCommandLineOption drop_option("drop",
+            "Percent of chunks dropped without ack.", "percent", "0");
+    parser.addOption(port_option);
+    parser.addOption(drop_option);
+    parser.process(app);
+
+    quint16 port = parser.value(port_option).toUShort();
+    int drop_percent = qBound(0, parser.value(drop_option).toInt(), 100);
+
+    QTextStream out(stdout);
+    QUdpSocket socket;
+    if (!socket.bind(QHostAddress::AnyIPv4, port)) {
+        out << "failed to bind port " << port << "\n";
+        return 1;
+    }
+
+    std::mt19937 rng(std::random_device{}());
+    std::uniform_int_distribution<int> percent(0, 99);
+    Reassembly current = {0, QByteArray(), QVector<bool>(), 0, 0};
+    bool has_transfer = false;
+
+    QObject::connect(&socket, &QUdpSocket::readyRead, [&]() {
+        while (socket.hasPendingDatagrams()) {
+            char buffer[optgui::TRAJ_CHUNK_HEADER_SIZE +
+                        optgui::TRAJ_CHUNK_PAYLOAD_SIZE];
+            QHostAddress address;
+            quint16 sender_port;
+            qint64 bytes_read = socket.readDatagram(buffer, sizeof(buffer),
+                                                    &address, &sender_port);
+
+            TrajChunkHeader header;
+            if (!optgui::readTrajChunkHeader(buffer, bytes_read, &header)) {
+                continue;
+            }
+            // simulate lost chunk
+            if (percent(rng) < drop_percent) {
+                out << "drop transfer=" << header.transfer
+                    << " chunk=" << header.index << "\n";
+                out.flush();
+                continue;
+            }
+
+            // ack every received chunk, acks may be lost too
+            char ack[optgui::TRAJ_ACK_SIZE];
+            optgui::writeTrajAck(header.transfer, header.index, ack);
+            socket.writeDatagram(ack, optgui::TRAJ_ACK_SIZE,
+                                 address, sender_port);
+
+            // newer transfer replaces one in progress
+            if (!has_transfer || header.transfer != current.transfer) {
+                current.transfer = header.transfer;
+                current.data.fill(0, header.count *
+                                  optgui::TRAJ_CHUNK_PAYLOAD_SIZE);
+                current.received.fill(false, header.count);
+                current.num_received = 0;
+                current.size = 0;
+                has_transfer = true;
+            }
+            if (header.count != current.received.size() ||
+                    current.received.at(header.index)) {
+                continue;
+            }
+
+            // place chunk at its offset
+            qint64 offset = header.index * optgui::TRAJ_CHUNK_PAYLOAD_SIZE;
+            std::memcpy(current.data.data() + offset,
+                        buffer + optgui::TRAJ_CHUNK_HEADER_SIZE,
+                        header.length);
+            current.received[header.index] = true;
+            current.num_received++;
+            current.size = qMax(current.size, offset + header.length);
+
+            if (current.num_received == header.count) {
+                // deserialize reassembled packet
+                autogen::deserializable::traj3dof
+                        <autogen::topic::traj3dof::UNDEFINED> traj;
+                const uint8 *ptr_traj = traj.deserialize(
+                            reinterpret_cast<const uint8 *>(
+                                current.data.constData()));
+                out << "transfer=" << current.transfer
+                    << " chunks=" << header.count
+                    << " bytes=" << current.size;
+                if (ptr_traj != NULL) {
+                    out << " K=" << traj.K
+                        << " final_time=" << traj.time(traj.K - 1);
+                } else {
+                    out << " invalid traj3dof";
+                }
+                out << "\n";
+                out.flush();
+            }
+        }
+    });
+
+    out << "listening on port " << port << "\n";
+    out.flush();
+    return app.exec();
+}
@@ -0,0 +1,26 @@
+#-------------------------------------------------
+#
+# Local vehicle stub acknowledging chunked trajectory uplink
+#
+#-------------------------------------------------
+
+QT       += core network
+QT       -= gui
+
+TARGET = Optimization_Interface_Uplink_Stub
+TEMPLATE = app
+CONFIG += console
+CONFIG -= app_bundle
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+# resolve include/... paths from the gui project
+INCLUDEPATH += $$PWD/..
+
+include(../dependencies.pri)
+
+SOURCES += \
+    uplink_stub.cpp
+
+HEADERS += \
+    ../include/network/traj_chunk.h